@@ -2,9 +2,9 @@
 
 #include <cstdint>
 #include <string>
-#include <unordered_map>
-#include <vector>
+#include <memory>
 
+#include "Bee/Collision/AABB.hpp"
 #include "Bee/Collision/Hitbox.hpp"
 #include "Bee/Graphics/Animation.hpp"
 #include "Bee/Graphics/Color.hpp"
@@ -13,44 +13,73 @@
 
 class Entity;
 class HUDObject;
+class World;
+struct EntityStorage;
+struct SpriteSheet;
 
 class BaseObject
 {
     friend Entity;
     friend HUDObject;
+    friend EntityStorage;
+    friend class EntityPoolBase;
+    friend World;
     
 public:
     void setShader(const std::string& shader);
     void setAnimation(const std::string& animationName);
+    void setAnimation(AnimationId animation);
+    void setAnimationSpeed(float speed);
+    float getAnimationSpeed() const;
+    bool isAnimationFinished() const;
     void setSprite(const std::string& spriteName);
     void setText(const std::string& text, const std::string& font, int fontSize, const Color& color);
     void setScale(const Vector2f& scale);
     void setHitboxScale(float scale);
     void setHitboxScale(const Vector2f& scale);
+    void setHitbox(const Hitbox& hitbox);
+    void setRotation(float rotation);
     void setPosition(const Vector2f& position);
     void setPosition(const Vector3f& position);
     void setPositionZ(float z);
     void moveOffset(const Vector2f& offset);
     Vector3f getPosition() const;
     Vector2f getScale() const;
+    float getRotation() const;
     Vector2i getTextureSize() const;
-    Hitbox getHitBox() const;
+    const Hitbox& getHitBox() const;
+    const AABB& getAABB() const;
     virtual void update();
     virtual void onDraw();
+    virtual void onAnimationFinished(AnimationId animation);
     virtual ~BaseObject() = default;
 
 private:
+    EntityStorage* storage = nullptr;
+    uint32_t storageIndex = 0;
     int shaderID = 0;
     int textureID = 0;
-    int currentSprite = 0;
-    uint32_t frameStartTime = 0;
-    std::string currentAnimationName;
-    std::vector<SpriteFrame> frames;
-    std::unordered_map<std::string, FrameTag> animations;
-    AnimationDirection currentAnimationDirection = AnimationDirection::none;
-    FrameTag currentAnimation = {};
+    std::shared_ptr<const SpriteSheet> spriteSheet;
+    AnimationState animationState;
     Vector3f position;
     Vector2f scale = {1.0f, 1.0f};
     Vector2f rotationCenter = {0.5f, 0.5f};
     Vector2f hitboxScale = {1.0f, 1.0f};
+    float rotation = 0.0f;
+    bool customHitbox = false;
+    Hitbox localHitbox;
+    mutable bool hitboxDirty = true;
+    mutable Hitbox hitbox;
+    mutable AABB aabb;
+    static bool hitboxesFrozen;
+
+    bool playAnimation(AnimationId animation);
+    Vector3f& positionData();
+    const Vector3f& positionData() const;
+    Vector2f& scaleData();
+    const Vector2f& scaleData() const;
+    float& rotationData();
+    float rotationData() const;
+    AnimationState& animationData();
+    void updateHitbox() const;
 };
@@ -4,12 +4,21 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include "Audio.hpp"
+#include "EntityHandle.hpp"
+#include "EntityPool.hpp"
 #include "Log.hpp"
+#include "Prefab.hpp"
+#include "Collision/AABB.hpp"
+#include "Collision/CastResult.hpp"
+#include "Collision/CollisionFilter.hpp"
 #include "Collision/Hitbox.hpp"
 #include "Collision/Intersection.hpp"
+#include "Collision/MoveResult.hpp"
+#include "Collision/Ray.hpp"
 #include "Graphics/Renderer.hpp"
 #include "Graphics/Window.hpp"
 #include "Input/Controller.hpp"
@@ -19,6 +28,11 @@
 #include "Math/Vector2f.hpp"
 #include "Math/Vector2i.hpp"
 #include "Math/Vector4f.hpp"
+#include "World/CullingStats.hpp"
+#include "World/FlowField.hpp"
+#include "World/Path.hpp"
+#include "World/TileFlags.hpp"
+#include "World/UpdatePolicy.hpp"
 #include "World/World.hpp"
 #include "World/WorldObject.hpp"
 
@@ -63,4 +77,11 @@ namespace Bee
      * @return the time in milliseconds since the engine was initialized.
      */
     uint32_t getTime();
+
+    /**
+     * @brief Get the peak amount of per-frame scratch memory
+     * 
+     * @return the most bytes the engine's frame allocator handed out during a single frame.
+     */
+    size_t getFrameMemoryHighWaterMark();
 };
\ No newline at end of file
@@ -0,0 +1,38 @@
+/**
+ * @file AABB.hpp
+ */
+
+#pragma once
+
+#include "Bee/Math/Vector2f.hpp"
+
+struct AABB
+{
+    /**
+     * @brief The corner with the smallest coordinates.
+     * 
+     */
+    Vector2f min;
+
+    /**
+     * @brief The corner with the largest coordinates.
+     * 
+     */
+    Vector2f max;
+
+    /**
+     * @brief Check if two bounding boxes overlap.
+     * 
+     * @param other the other bounding box
+     * @return true if the bounding boxes overlap.
+     */
+    bool overlaps(const AABB& other) const;
+
+    /**
+     * @brief Check if a point lies inside the bounding box.
+     * 
+     * @param point the point in world coordinates
+     * @return true if the point lies inside the bounding box.
+     */
+    bool contains(const Vector2f& point) const;
+};
\ No newline at end of file
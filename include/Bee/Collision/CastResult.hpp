@@ -0,0 +1,50 @@
+/**
+ * @file CastResult.hpp
+ */
+
+#pragma once
+
+#include "Bee/Math/Vector2f.hpp"
+#include "Bee/Math/Vector2i.hpp"
+#include "Bee/World/WorldObject.hpp"
+
+class Entity;
+
+struct CastResult
+{
+    /**
+     * @brief Whether the cast hit anything.
+     * 
+     */
+    bool hit = false;
+
+    /**
+     * @brief The time of impact as a fraction of the cast displacement between 0 and 1.
+     * 
+     */
+    float time = 1.0f;
+
+    /**
+     * @brief The contact normal pointing from the hit object towards the cast shape.
+     * 
+     */
+    Vector2f normal = {0, 0};
+
+    /**
+     * @brief A pointer to the hit entity or NULL if no entity was hit.
+     * 
+     */
+    Entity* entity = nullptr;
+
+    /**
+     * @brief A pointer to the hit world object or NULL if no world object was hit.
+     * 
+     */
+    WorldObject* worldObject = nullptr;
+
+    /**
+     * @brief The position of the hit tile or (-1, -1) if no tile was hit.
+     * 
+     */
+    Vector2i tile = {-1, -1};
+};
\ No newline at end of file
@@ -0,0 +1,30 @@
+/**
+ * @file CollisionFilter.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+
+struct CollisionFilter
+{
+    /**
+     * @brief The collision layers the object belongs to as a bitset.
+     * 
+     */
+    uint32_t category = 1;
+
+    /**
+     * @brief The collision layers the object collides with as a bitset.
+     * 
+     */
+    uint32_t mask = 0xFFFFFFFF;
+
+    /**
+     * @brief Check if two filters let their objects collide.
+     * 
+     * @param other the other filter
+     * @return true if each category is part of the other mask.
+     */
+    bool shouldCollide(const CollisionFilter& other) const;
+};
\ No newline at end of file
@@ -4,12 +4,22 @@
 
 #include "Bee/Math/Vector2f.hpp"
 
+enum class HitboxShape
+{
+    polygon,
+    aabb,
+    obb,
+    ellipse,
+    point,
+};
+
 struct Hitbox
 {
     Vector2f center;
 
     std::vector<Vector2f> vertices;
 
-    bool isEllipse = false;
+    HitboxShape shape = HitboxShape::polygon;
     Vector2f ellipse;
+    Vector2f ellipseAxis = {1.0f, 0.0f};
 };
\ No newline at end of file
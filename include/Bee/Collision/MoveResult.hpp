@@ -0,0 +1,40 @@
+/**
+ * @file MoveResult.hpp
+ */
+
+#pragma once
+
+#include "Bee/Math/Vector2f.hpp"
+
+struct MoveResult
+{
+    /**
+     * @brief The movement that was actually applied to the entity.
+     * 
+     */
+    Vector2f displacement = {0, 0};
+
+    /**
+     * @brief Whether the entity is standing on a surface that is flatter than the maximum slope angle.
+     * 
+     */
+    bool onFloor = false;
+
+    /**
+     * @brief Whether the entity touches a surface that is steeper than the maximum slope angle.
+     * 
+     */
+    bool onWall = false;
+
+    /**
+     * @brief Whether the entity touches a surface above it.
+     * 
+     */
+    bool onCeiling = false;
+
+    /**
+     * @brief The normal of the floor the entity is standing on or (0, 0) if it is not on a floor.
+     * 
+     */
+    Vector2f floorNormal = {0, 0};
+};
\ No newline at end of file
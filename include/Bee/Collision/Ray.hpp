@@ -0,0 +1,43 @@
+/**
+ * @file Ray.hpp
+ */
+
+#pragma once
+
+#include "Bee/Collision/CollisionFilter.hpp"
+#include "Bee/Math/Vector2f.hpp"
+
+class Entity;
+
+struct Ray
+{
+    /**
+     * @brief The start of the ray in world coordinates.
+     * 
+     */
+    Vector2f origin;
+
+    /**
+     * @brief The direction of the ray scaled by its length.
+     * 
+     */
+    Vector2f displacement;
+
+    /**
+     * @brief An entity the ray should pass through, usually the entity casting the ray.
+     * 
+     */
+    const Entity* ignore = nullptr;
+
+    /**
+     * @brief Whether the ray should pass through all entities and only hit tiles and world objects.
+     * 
+     */
+    bool ignoreEntities = false;
+
+    /**
+     * @brief The collision layers of the ray. Objects whose filter rejects the ray are passed through.
+     * 
+     */
+    CollisionFilter filter;
+};
\ No newline at end of file
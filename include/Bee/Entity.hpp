@@ -1,15 +1,77 @@
 #pragma once
 
+#include <typeindex>
+
 #include "Bee/BaseObject.hpp"
+#include "Bee/EntityHandle.hpp"
+#include "Bee/Collision/CastResult.hpp"
+#include "Bee/Collision/CollisionFilter.hpp"
 #include "Bee/Collision/Intersection.hpp"
+#include "Bee/Collision/MoveResult.hpp"
+#include "Bee/World/Path.hpp"
+#include "Bee/World/TileFlags.hpp"
+#include "Bee/World/UpdatePolicy.hpp"
+
+class EntityPoolBase;
+class World;
 
 class Entity : public BaseObject
 {
 public:
     bool isCursorOnMe() const;
+    EntityHandle getHandle() const;
+    const std::string& getName() const;
+    void setName(const std::string& name);
+    uint32_t getTags() const;
+    void setTags(uint32_t tags);
+    bool hasTags(uint32_t tags) const;
     std::vector<Intersection> getIntersections() const;
+    CastResult castShape(const Vector2f& displacement) const;
+    MoveResult moveAndSlide(const Vector2f& displacement, const Vector2f& up = {0, -1}, float maxSlopeAngle = 45.0f);
+    const CollisionFilter& getCollisionFilter() const;
+    void setCollisionFilter(const CollisionFilter& filter);
+    bool hasCollisionEvents() const;
+    void setCollisionEvents(bool enabled);
+    UpdatePolicy getUpdatePolicy() const;
+    void setUpdatePolicy(UpdatePolicy policy);
+    float getUpdateDeltaTime() const;
+    bool isSleeping() const;
+    void sleep(float wakeDistance = 0.0f);
+    void wake();
+    bool hasParallelUpdate() const;
+    void setParallelUpdate(bool enabled);
+    void requestPath(const Vector2i& to, uint32_t blockingFlags = TileFlags::solid, PathAlgorithm algorithm = PathAlgorithm::jumpPointSearch);
     void setScale(float scale);
     void setSprite(const std::string& spriteName);
     void setText(const std::string& text, const std::string& font, int fontSize, const Color& color);
     void update() override;
+    virtual void updateParallel();
+    virtual void onCollisionEnter(const Intersection& intersection);
+    virtual void onCollisionStay(const Intersection& intersection);
+    virtual void onCollisionExit(const Intersection& intersection);
+    virtual void onTriggerEnter(const Intersection& intersection);
+    virtual void onTriggerStay(const Intersection& intersection);
+    virtual void onTriggerExit(const Intersection& intersection);
+    virtual void onPathResult(const std::vector<Vector2i>& path);
+    virtual void onSpawn();
+
+private:
+    CollisionFilter collisionFilter;
+    bool collisionEvents = false;
+    bool parallelUpdate = false;
+    bool sleeping = false;
+    UpdatePolicy updatePolicy = UpdatePolicy::always;
+    float wakeDistance = 0.0f;
+    float accumulatedTime = 0.0f;
+    float updateDeltaTime = 0.0f;
+    std::vector<CastResult> slideContacts;
+    EntityHandle handle;
+    World* world = nullptr;
+    EntityPoolBase* pool = nullptr;
+    std::string name;
+    uint32_t tags = 0;
+    std::type_index type = typeid(Entity);
+
+    friend class EntityPoolBase;
+    friend class World;
 };
@@ -0,0 +1,29 @@
+/**
+ * @file EntityHandle.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief A weak reference to an entity in a world. A handle to an entity that was removed or deleted
+ * never refers to another entity, even if the entity's slot is reused.
+ * 
+ */
+struct EntityHandle
+{
+    /**
+     * @brief The slot of the entity in the world.
+     * 
+     */
+    uint32_t index = UINT32_MAX;
+
+    /**
+     * @brief How often the slot was reused when the handle was created.
+     * 
+     */
+    uint32_t generation = 0;
+
+    bool operator==(const EntityHandle& other) const = default;
+};
\ No newline at end of file
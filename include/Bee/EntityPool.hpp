@@ -0,0 +1,127 @@
+/**
+ * @file EntityPool.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "Bee/Entity.hpp"
+#include "Bee/Prefab.hpp"
+
+struct SpriteSheet;
+
+class EntityPoolBase
+{
+public:
+    /**
+     * @brief Load the resources of a prefab.
+     * 
+     * @param prefab the description of the pooled entities
+     */
+    explicit EntityPoolBase(const Prefab& prefab);
+
+    EntityPoolBase(const EntityPoolBase&) = delete;
+    EntityPoolBase& operator=(const EntityPoolBase&) = delete;
+    virtual ~EntityPoolBase();
+
+    /**
+     * @brief Get the prefab of the pool.
+     * 
+     * @return the description of the pooled entities.
+     */
+    const Prefab& getPrefab() const;
+
+protected:
+    void prepare(Entity* entity);
+
+private:
+    Prefab prefab;
+    std::shared_ptr<const SpriteSheet> spriteSheet;
+    int shaderID = 0;
+    AnimationId animation;
+
+    virtual void recycle(Entity* entity) = 0;
+
+    friend class World;
+};
+
+/**
+ * @brief Allocates entities of one type in blocks and reuses them after they were destroyed by the world.
+ * Destroying a pooled entity with World::destroyEntity() or World::deleteAllEntities() returns it to the pool
+ * instead of deleting it. The pool must outlive all of its entities.
+ * 
+ * @tparam T the type of the entities
+ */
+template<typename T>
+class EntityPool : public EntityPoolBase
+{
+    static_assert(std::is_base_of_v<Entity, T>, "T must be derived from Entity");
+
+public:
+    /**
+     * @brief Create an empty pool.
+     * 
+     * @param prefab the description of the pooled entities
+     * @param blockSize the number of entities allocated at once
+     */
+    explicit EntityPool(const Prefab& prefab, const size_t blockSize = 256)
+        : EntityPoolBase(prefab), blockSize(blockSize) {}
+
+    ~EntityPool() override
+    {
+        for (T* entity : entities)
+        {
+            entity->~T();
+        }
+    }
+
+    /**
+     * @brief Get an entity that is set up as described by the prefab. Entity::onSpawn() is called before returning.
+     * 
+     * @return a recycled entity or a new one if no entity is free.
+     */
+    T* spawn()
+    {
+        T* entity;
+
+        if (!freeEntities.empty())
+        {
+            entity = freeEntities.back();
+            freeEntities.pop_back();
+        }
+        else
+        {
+            if (entities.size() % blockSize == 0)
+            {
+                blocks.push_back(std::make_unique<Slot[]>(blockSize));
+            }
+
+            entity = new (blocks.back()[entities.size() % blockSize].data) T();
+            entities.push_back(entity);
+        }
+
+        prepare(entity);
+        return entity;
+    }
+
+private:
+    struct Slot
+    {
+        alignas(T) std::byte data[sizeof(T)];
+    };
+
+    size_t blockSize;
+    std::vector<std::unique_ptr<Slot[]>> blocks;
+    std::vector<T*> entities;
+    std::vector<T*> freeEntities;
+
+    void recycle(Entity* entity) override
+    {
+        freeEntities.push_back(static_cast<T*>(entity));
+    }
+};
\ No newline at end of file
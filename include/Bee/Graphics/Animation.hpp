@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
+#include <string_view>
+
 enum class AnimationDirection
 {
     none,
@@ -9,10 +13,41 @@ enum class AnimationDirection
     reversePingPong,
 };
 
+/**
+ * @brief A handle for an animation name, computed with the 32 bit FNV-1a hash of the name.
+ * Use the _animation literal to compute handles at compile time.
+ * 
+ */
+struct AnimationId
+{
+    uint32_t value = 0;
+
+    constexpr AnimationId() = default;
+
+    constexpr explicit AnimationId(const std::string_view name)
+    {
+        value = 2166136261u;
+
+        for (const char c : name)
+        {
+            value ^= static_cast<uint8_t>(c);
+            value *= 16777619u;
+        }
+    }
+
+    constexpr bool operator==(const AnimationId& other) const = default;
+};
+
+consteval AnimationId operator""_animation(const char* name, const size_t length)
+{
+    return AnimationId(std::string_view(name, length));
+}
+
 struct FrameTag
 {
     int start = 0;
     int end = 0;
+    int repeat = 0;
     AnimationDirection direction = AnimationDirection::none;
 };
 
@@ -23,4 +58,17 @@ struct SpriteFrame
     int w = 0;
     int h = 0;
     int duration = 0;
+};
+
+struct AnimationState
+{
+    AnimationId id;
+    FrameTag animation;
+    std::span<const SpriteFrame> frames;
+    int sprite = 0;
+    float elapsed = 0.0f;
+    float speed = 1.0f;
+    uint32_t loops = 0;
+    AnimationDirection direction = AnimationDirection::none;
+    bool finished = false;
 };
\ No newline at end of file
@@ -10,4 +10,9 @@ public:
     void setSprite(const std::string& spriteName);
     void setText(const std::string& text, const std::string& font, int fontSize, const Color& color);
     void update() override;
+
+private:
+    bool queue();
+
+    friend class World;
 };
@@ -0,0 +1,73 @@
+/**
+ * @file Prefab.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "Bee/Collision/CollisionFilter.hpp"
+#include "Bee/Collision/Hitbox.hpp"
+
+/**
+ * @brief The description of an entity that is shared by all instances of an entity pool.
+ * 
+ */
+struct Prefab
+{
+    /**
+     * @brief The name of the sprite in the sprites folder.
+     * 
+     */
+    std::string sprite;
+
+    /**
+     * @brief The name of the shader or an empty string for the default shader.
+     * 
+     */
+    std::string shader;
+
+    /**
+     * @brief The animation that is played after spawning.
+     * 
+     */
+    std::string animation;
+
+    /**
+     * @brief The height of the entity in tiles.
+     * 
+     */
+    float scale = 1.0f;
+
+    /**
+     * @brief The custom hitbox or no value to use the sprite bounds.
+     * 
+     */
+    std::optional<Hitbox> hitbox;
+
+    /**
+     * @brief The collision filter of the entity.
+     * 
+     */
+    CollisionFilter collisionFilter;
+
+    /**
+     * @brief Whether the entity receives collision events.
+     * 
+     */
+    bool collisionEvents = false;
+
+    /**
+     * @brief The name of the entity.
+     * 
+     */
+    std::string name;
+
+    /**
+     * @brief The tag bitset of the entity.
+     * 
+     */
+    uint32_t tags = 0;
+};
\ No newline at end of file
@@ -0,0 +1,34 @@
+/**
+ * @file CullingStats.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+
+struct CullingStats
+{
+    /**
+     * @brief The number of entities that were queued for drawing in the last frame.
+     * 
+     */
+    uint32_t drawnEntities = 0;
+
+    /**
+     * @brief The number of entities that were skipped because they were outside the viewport.
+     * 
+     */
+    uint32_t culledEntities = 0;
+
+    /**
+     * @brief The number of HUD objects that were queued for drawing in the last frame.
+     * 
+     */
+    uint32_t drawnHUDObjects = 0;
+
+    /**
+     * @brief The number of HUD objects that were skipped because they were outside the screen.
+     * 
+     */
+    uint32_t culledHUDObjects = 0;
+};
\ No newline at end of file
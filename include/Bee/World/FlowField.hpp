@@ -0,0 +1,61 @@
+/**
+ * @file FlowField.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Bee/Math/Vector2f.hpp"
+#include "Bee/Math/Vector2i.hpp"
+
+class FlowField
+{
+public:
+    /**
+     * @brief Get the goal tile of the flow field.
+     * 
+     * @return the goal tile.
+     */
+    const Vector2i& getGoal() const;
+
+    /**
+     * @brief Get the direction to move in to reach the goal on the shortest path.
+     * 
+     * @param position the position in world coordinates
+     * @return a normalized direction or (0, 0) at the goal and where the goal can't be reached.
+     */
+    Vector2f getDirection(const Vector2f& position) const;
+
+    /**
+     * @brief Get the length of the shortest path to the goal in tiles.
+     * 
+     * @param position the position in world coordinates
+     * @return the length of the path or infinity if the goal can't be reached.
+     */
+    float getDistance(const Vector2f& position) const;
+
+private:
+    int width = 0;
+    int height = 0;
+    Vector2i goal;
+    uint32_t blockingFlags = 0;
+    uint64_t lastUsedFrame = 0;
+    std::vector<float> distances;
+    std::vector<uint8_t> directions;
+    std::vector<std::pair<float, int>> openList;
+    std::vector<int> changedCells;
+
+    int getCell(const Vector2f& position) const;
+    bool isWalkable(std::span<const uint32_t> cellFlags, int x, int y) const;
+    bool canMove(std::span<const uint32_t> cellFlags, int index, int direction) const;
+    void build(std::span<const uint32_t> cellFlags, int width, int height, const Vector2i& goal, uint32_t blockingFlags);
+    void updateCell(std::span<const uint32_t> cellFlags, int x, int y);
+    void relax(std::span<const uint32_t> cellFlags, int index);
+    void propagate(std::span<const uint32_t> cellFlags);
+    void updateDirection(std::span<const uint32_t> cellFlags, int index);
+
+    friend class World;
+};
\ No newline at end of file
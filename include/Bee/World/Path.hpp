@@ -0,0 +1,16 @@
+/**
+ * @file Path.hpp
+ */
+
+#pragma once
+
+/**
+ * @brief The search algorithm used to find a path on the tile grid. Both find the same shortest path length,
+ * jump point search is usually much faster on open maps.
+ * 
+ */
+enum class PathAlgorithm
+{
+    aStar,
+    jumpPointSearch,
+};
\ No newline at end of file
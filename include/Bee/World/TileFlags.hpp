@@ -0,0 +1,23 @@
+/**
+ * @file TileFlags.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Bit flags that are compiled from the bool properties of the same name on a tile when a tilemap is loaded.
+ * An int property `"flags"` on a tile is added to them for game specific flags starting at `TileFlags::user`.
+ * 
+ */
+namespace TileFlags
+{
+    constexpr uint32_t none = 0;
+    constexpr uint32_t solid = 1 << 0;
+    constexpr uint32_t water = 1 << 1;
+    constexpr uint32_t damage = 1 << 2;
+    constexpr uint32_t ladder = 1 << 3;
+    constexpr uint32_t oneWay = 1 << 4;
+    constexpr uint32_t user = 1 << 8;
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+/**
+ * @file UpdatePolicy.hpp
+ */
+
+#pragma once
+
+/**
+ * @brief How often the world calls the update functions of an entity.
+ * 
+ */
+enum class UpdatePolicy
+{
+    /**
+     * @brief Update every frame.
+     * 
+     */
+    always,
+
+    /**
+     * @brief Update only while the sprite bounds overlap the viewport.
+     * 
+     */
+    onScreen,
+
+    /**
+     * @brief Update every frame on screen and less often the farther the entity is outside the viewport.
+     * 
+     */
+    distance,
+};
\ No newline at end of file
@@ -4,18 +4,42 @@
 
 #pragma once
 
+#include <array>
+#include <map>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <typeindex>
+#include <unordered_map>
 #include <vector>
 
 #include "Bee/Entity.hpp"
+#include "Bee/Collision/CastResult.hpp"
 #include "Bee/Collision/Intersection.hpp"
+#include "Bee/Collision/MoveResult.hpp"
+#include "Bee/Collision/Ray.hpp"
 #include "Bee/Graphics/HUDObject.hpp"
+#include "Bee/World/CullingStats.hpp"
+#include "Bee/World/FlowField.hpp"
+#include "Bee/World/Path.hpp"
+#include "Bee/World/TileFlags.hpp"
 #include "Bee/World/WorldObject.hpp"
 
+class JobSystem;
+class Pathfinder;
+struct Contact;
+struct ContactProxy;
+struct EntitySlot;
+struct EntityStorage;
 struct Tile;
 struct TileLayer;
+struct WorldCommand;
 
 class World
 {
+    friend Entity;
+
 public:
     /**
      * @brief Default constructor.
@@ -25,34 +49,93 @@ public:
 
     /**
      * @brief Add an entity to the world.
+     * Entities added while the world is updated are updated starting with the next frame.
      * 
      * @param entity the pointer to the entity
+     * @return the handle of the entity.
+     */
+    EntityHandle addEntity(Entity* entity);
+
+    /**
+     * @brief Get an entity in the world by its handle.
+     * 
+     * @param handle the handle of the entity
+     * @return the pointer to the entity or NULL if the entity was removed from the world.
      */
-    void addEntity(Entity* entity);
+    Entity* getEntity(const EntityHandle& handle) const;
 
     /**
      * @brief Get an entity in the world by name.
      * 
      * @param name the name of the entity
-     * @return the first entity in the world that has the specified name.
+     * @return the entity that was added first of all entities in the world that have the specified name
+     * or NULL if there is no such entity.
+     */
+    Entity* getEntityByName(std::string_view name) const;
+
+    /**
+     * @brief Get all entities in the world that have a specific name.
+     * 
+     * @param name the name of the entities
+     * @return the entities with the specified name in the order they were added.
+     */
+    std::span<Entity* const> getEntitiesByName(std::string_view name) const;
+
+    /**
+     * @brief Get all entities in the world that have a specific tag.
+     * 
+     * @param tag a single bit of the tag bitset
+     * @return the entities with the specified tag. The order changes when entities are removed.
+     */
+    std::span<Entity* const> getEntitiesWithTag(uint32_t tag) const;
+
+    /**
+     * @brief Get all entities in the world of a specific type.
+     * Entities of types derived from T are not included.
+     * 
+     * @tparam T the type of the entities
+     * @return the entities of the specified type. The order changes when entities are removed.
+     */
+    template<typename T>
+    std::span<Entity* const> getEntitiesByType() const
+    {
+        return getEntitiesByType(typeid(T));
+    }
+
+    /**
+     * @brief Get all entities in the world of a specific type.
+     * Entities of derived types are not included.
+     * 
+     * @param type the type of the entities
+     * @return the entities of the specified type. The order changes when entities are removed.
      */
-    Entity* getEntityByName(const std::string& name) const;
+    std::span<Entity* const> getEntitiesByType(std::type_index type) const;
 
     /**
      * @brief Get all the entities in the world.
      * 
-     * @return all the entities in the world.
+     * @return all the entities in the world. The order changes when entities are removed.
      */
-    std::vector<Entity*> getAllEntities();
+    std::span<Entity* const> getAllEntities() const;
 
     /**
      * @brief Remove an entity from the world.
+     * Entities removed while the world is updated stay in getAllEntities() until all objects were updated,
+     * so they must not be deleted before that. Use destroyEntity() instead.
      * 
      * @param entity the pointer to the entity
      * @return the pointer to the entity if the entity could be removed, NULL otherwise.
      */
     Entity* removeEntity(Entity* entity);
 
+    /**
+     * @brief Remove an entity from the world and delete it.
+     * Entities destroyed while the world is updated are deleted after all objects were updated.
+     * 
+     * @param entity the pointer to the entity
+     */
+    void destroyEntity(Entity* entity);
+
     /**
      * @brief Removes all entities from the world and the deletes them.
      * 
@@ -71,16 +154,25 @@ public:
      * 
      * @return all the HUD objects in the world.
      */
-    std::vector<HUDObject*> getAllHUDObjects();
+    std::span<HUDObject* const> getAllHUDObjects() const;
 
     /**
      * @brief Remove a HUD object from the world.
+     * HUD objects removed while the world is updated are removed after all objects were updated,
+     * so they must not be deleted before that. Use destroyHUDObject() instead.
      * 
      * @param hudObject the pointer to the HUD object
      * @return the pointer to the HUD object if the HUD object could be removed, NULL otherwise. 
      */
     HUDObject* removeHUDObject(HUDObject* hudObject);
 
+    /**
+     * @brief Remove a HUD object from the world and delete it.
+     * 
+     * @param hudObject the pointer to the HUD object
+     */
+    void destroyHUDObject(HUDObject* hudObject);
+
     /**
      * @brief Removes all HUD objects from the world and deletes them.
      * 
@@ -92,7 +184,7 @@ public:
      *
      * @return all the world objects in the world.
      */
-    std::vector<WorldObject*> getAllWorldObjects() const;
+    std::span<WorldObject* const> getAllWorldObjects() const;
 
     /**
      * @brief Load a tilemap.
@@ -109,6 +201,23 @@ public:
      */
     const Properties& getTileProperties(const Vector2f& position) const;
 
+    /**
+     * @brief Get the flags of the topmost tile at a position. See TileFlags.
+     * 
+     * @param position the position of the tile in world coordinates
+     * @return the flags of the tile or `TileFlags::none` if there is no tile.
+     */
+    uint32_t getTileFlags(const Vector2f& position) const;
+
+    /**
+     * @brief Change a tile of a tile layer.
+     * 
+     * @param layerName the name of the tile layer
+     * @param position the position of the tile in tiles
+     * @param tileId the global id of the new tile or 0 to clear it
+     */
+    void setTile(const std::string& layerName, const Vector2i& position, int tileId);
+
     /**
      * @brief Get all intersections with entities and world objects of an entity.
      * 
@@ -117,8 +226,142 @@ public:
      */
     std::vector<Intersection> getIntersections(const Entity* entity) const;
 
+    /**
+     * @brief Sweep a hitbox along a displacement and find the first entity or world object it hits.
+     * 
+     * @param hitbox the hitbox at the start of the sweep in world coordinates
+     * @param displacement the movement of the hitbox during the sweep
+     * @param ignore an entity that should not be hit, usually the entity the hitbox belongs to
+     * @param filter the collision layers of the hitbox
+     * @return the earliest hit along the displacement.
+     */
+    CastResult castShape(const Hitbox& hitbox, const Vector2f& displacement, const Entity* ignore = nullptr, const CollisionFilter& filter = {}) const;
+
+    /**
+     * @brief Move an entity and slide it along the entities and world objects it runs into.
+     * Overlaps are pushed out first and the contacts of the previous move are reused to clip the displacement early.
+     * 
+     * @param entity the pointer to the entity
+     * @param displacement the desired movement of the entity
+     * @param up the direction that points away from the floor
+     * @param maxSlopeAngle the steepest surface in degrees that still counts as floor and can be walked up, clamped below 90
+     * @return the applied movement and the kinds of surfaces that were touched.
+     */
+    MoveResult moveAndSlide(Entity* entity, const Vector2f& displacement, const Vector2f& up = {0, -1}, float maxSlopeAngle = 45.0f);
+
+    /**
+     * @brief Cast a ray through the tile layers, world objects and entities.
+     * 
+     * @param ray the ray
+     * @param isBlocking decides from the properties of the topmost tile in a cell if the ray stops there. Tiles are ignored if NULL.
+     * @return the earliest hit along the ray.
+     */
+    CastResult raycast(const Ray& ray, bool (*isBlocking)(const Properties& properties) = nullptr) const;
+
+    /**
+     * @brief Cast a ray through the tile layers, world objects and entities.
+     * 
+     * @param ray the ray
+     * @param blockingFlags the ray stops at the first tile that has any of these flags
+     * @return the earliest hit along the ray.
+     */
+    CastResult raycast(const Ray& ray, uint32_t blockingFlags) const;
+
+    /**
+     * @brief Cast many rays at once. The predicate is evaluated at most once per tile type for the whole batch.
+     * 
+     * @param rays the rays
+     * @param results the earliest hit of each ray, must be at least as large as rays
+     * @param isBlocking decides from the properties of the topmost tile in a cell if a ray stops there. Tiles are ignored if NULL.
+     */
+    void raycast(std::span<const Ray> rays, std::span<CastResult> results, bool (*isBlocking)(const Properties& properties) = nullptr) const;
+
+    /**
+     * @brief Check if there is nothing but entities between two points.
+     * 
+     * @param from the first point in world coordinates
+     * @param to the second point in world coordinates
+     * @param isBlocking decides from the properties of the topmost tile in a cell if it blocks the line of sight. Tiles are ignored if NULL.
+     * @return true if no tile or world object blocks the line of sight.
+     */
+    bool hasLineOfSight(const Vector2f& from, const Vector2f& to, bool (*isBlocking)(const Properties& properties) = nullptr) const;
+
+    /**
+     * @brief Check if there is nothing but entities between two points.
+     * 
+     * @param from the first point in world coordinates
+     * @param to the second point in world coordinates
+     * @param blockingFlags tiles with any of these flags block the line of sight
+     * @return true if no tile or world object blocks the line of sight.
+     */
+    bool hasLineOfSight(const Vector2f& from, const Vector2f& to, uint32_t blockingFlags) const;
+
+    /**
+     * @brief Find the shortest path between two tiles right away. Paths are cached until a tile changes.
+     * 
+     * @param from the start tile
+     * @param to the goal tile
+     * @param blockingFlags tiles with any of these flags can't be walked on
+     * @param algorithm the search algorithm
+     * @return the tiles along the path including start and goal or an empty vector if there is no path.
+     */
+    std::vector<Vector2i> findPath(const Vector2i& from, const Vector2i& to, uint32_t blockingFlags = TileFlags::solid, PathAlgorithm algorithm = PathAlgorithm::jumpPointSearch);
+
+    /**
+     * @brief Request a path for an entity. Requests are solved together on worker threads and
+     * the result is passed to Entity::onPathResult at the start of the next frame.
+     * 
+     * @param entity the pointer to the entity that receives the path
+     * @param from the start tile
+     * @param to the goal tile
+     * @param blockingFlags tiles with any of these flags can't be walked on
+     * @param algorithm the search algorithm
+     */
+    void requestPath(Entity* entity, const Vector2i& from, const Vector2i& to, uint32_t blockingFlags = TileFlags::solid, PathAlgorithm algorithm = PathAlgorithm::jumpPointSearch);
+
+    /**
+     * @brief Get a flow field that leads every tile to a goal tile. Flow fields are built on first use,
+     * updated when tiles change and dropped when they haven't been used for 60 frames.
+     * 
+     * @param goal the goal tile
+     * @param blockingFlags tiles with any of these flags can't be walked on
+     * @return the flow field, which stays valid while it is used at least once every 60 frames.
+     */
+    const FlowField& getFlowField(const Vector2i& goal, uint32_t blockingFlags = TileFlags::solid);
+
+    /**
+     * @brief Set how entities with UpdatePolicy::distance are updated outside the viewport. Entities in the first band
+     * outside the viewport are updated every second frame and the interval doubles with every further band.
+     * Entity::getUpdateDeltaTime() returns the time since the last update of an entity.
+     * 
+     * @param bandSize the width of a distance band in tiles, must be positive
+     * @param maxInterval the maximum number of frames between two updates
+     */
+    void setUpdateLevelOfDetail(float bandSize, uint32_t maxInterval);
+
+    /**
+     * @brief Set how far outside the viewport entities are still drawn. Entities are culled by their sprite bounds,
+     * so a margin is only needed for shaders that draw outside of them.
+     * 
+     * @param margin the margin around the viewport in tiles
+     */
+    void setCullingMargin(float margin);
+
+    /**
+     * @brief Get how many entities and HUD objects were drawn and culled in the last frame.
+     * 
+     * @return the culling statistics of the last frame.
+     */
+    const CullingStats& getCullingStats() const;
+
     /**
      * @brief The update function can be implemented in inheriting classes. This function is called once every frame.
+     * Entities with a parallel update first run Entity::updateParallel() on worker threads. It may only change the entity
+     * itself and must not call any world functions. Hitboxes and AABBs are refreshed before this phase and stay frozen
+     * during it, so the hitbox of an entity moved in Entity::updateParallel() follows once the phase is over. Afterwards
+     * every entity runs Entity::update() on the main thread.
+     * Entities are skipped according to their UpdatePolicy. Sleeping entities are skipped until Entity::wake() is called,
+     * a collision or trigger starts, or the camera comes within their wake distance.
      * 
      */
     virtual void update();
@@ -142,15 +385,78 @@ public:
     virtual ~World();
 
 private:
+    struct NameHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(const std::string_view name) const
+        {
+            return std::hash<std::string_view>()(name);
+        }
+    };
+
     int worldHeight = 0;
     int worldWidth = 0;
     int nullLayer = 0;
     std::vector<Entity*> entities;
+    std::vector<uint32_t> entitySlotIndices;
+    std::vector<EntitySlot> entitySlots;
+    uint32_t freeEntitySlot = UINT32_MAX;
+    std::unique_ptr<EntityStorage> entityStorage;
+    std::unordered_map<std::string, std::vector<Entity*>, NameHash, std::equal_to<>> entityNames;
+    std::array<std::vector<Entity*>, 32> entityTags;
+    std::unordered_map<std::type_index, std::vector<Entity*>> entityTypes;
     std::vector<WorldObject*> worldObjects;
     std::vector<HUDObject*> hudObjects;
     std::vector<TileLayer> foregroundLayers;
     std::vector<TileLayer> layers;
     std::vector<Tile> tiles;
+    std::vector<uint32_t> tileFlags;
+    std::vector<int> topmostTileIds;
+    std::vector<uint32_t> cellFlags;
+    std::map<std::tuple<int, int, uint32_t>, FlowField> flowFields;
+    uint64_t frame = 0;
+    std::unique_ptr<Pathfinder> pathfinder;
+    std::unique_ptr<JobSystem> jobSystem;
+    std::vector<Entity*> scheduledEntities;
+    std::vector<Entity*> parallelEntities;
+    float updateBandSize = 16.0f;
+    float cullingMargin = 1.0f;
+    CullingStats cullingStats;
+    uint32_t maxUpdateInterval = 16;
+    std::vector<Contact> contacts;
+    std::vector<Contact> previousContacts;
+    std::vector<ContactProxy> contactProxies;
+    std::vector<const Entity*> removedContactEntities;
+    std::vector<CastResult> slideCandidates;
+    std::vector<WorldCommand> commands;
+    bool dispatchingContacts = false;
+    bool deferringChanges = false;
 
     void loadTileset(const std::string &source, int firstId);
+    bool containsEntity(const Entity* entity) const;
+    bool containsHUDObject(const HUDObject* hudObject) const;
+    static void deleteEntity(Entity* entity);
+    void insertEntity(uint32_t slotIndex);
+    void detachEntity(Entity* entity);
+    void releaseEntitySlot(uint32_t slotIndex);
+    void indexEntity(Entity* entity);
+    void unindexEntity(Entity* entity);
+    void unindexEntityName(const Entity* entity);
+    void setEntityName(Entity* entity, const std::string& name);
+    void setEntityTags(Entity* entity, uint32_t tags);
+    void scheduleEntities();
+    void updateParallel();
+    void queueEntities();
+    void queueHUDObject(HUDObject* hudObject);
+    void applyCommands();
+    void updateContacts();
+    void dispatchContacts();
+    void removeContacts(const Entity* entity);
+    int getTopmostTileId(int x, int y) const;
+    int getTopmostTileId(const Vector2f& position) const;
+    void updateTopmostTileId(int x, int y);
+    template<typename BlockingFunc>
+    void raycastTiles(const Ray& ray, BlockingFunc isBlockingTile, CastResult& result) const;
+    void raycastObjects(const Ray& ray, CastResult& result) const;
 };
\ No newline at end of file
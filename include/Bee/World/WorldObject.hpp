@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "Bee/Properties.hpp"
+#include "Bee/Collision/AABB.hpp"
+#include "Bee/Collision/CollisionFilter.hpp"
 #include "Bee/Collision/Hitbox.hpp"
 
 class WorldObject
@@ -16,10 +21,29 @@ public:
      */
     Properties properties;
 
-    Hitbox getHitbox() const;
+    const Hitbox& getHitbox() const;
+
+    const AABB& getAABB() const;
+
+    const CollisionFilter& getCollisionFilter() const;
+
+    size_t getConvexPartCount() const;
+
+    std::span<const Vector2f> getConvexPart(size_t index) const;
+
+    bool isTrigger() const;
     
     void setHitbox(const Hitbox& hitbox);
 
+    void setCollisionFilter(const CollisionFilter& filter);
+
+    void setTrigger(bool trigger);
+
 private:
     Hitbox hitbox;
+    AABB aabb;
+    std::vector<Vector2f> convexVertices;
+    std::vector<size_t> convexOffsets;
+    CollisionFilter collisionFilter;
+    bool trigger = false;
 };
\ No newline at end of file
@@ -1,13 +1,21 @@
 #include "Bee/BaseObject.hpp"
 
-#include <fstream>
+#include <cmath>
 #include <string>
-
-#include <nlohmann/json.hpp>
+#include <vector>
 
 #include "Bee/Bee.hpp"
 #include "Bee/Log.hpp"
+#include "Bee/Math/Math.hpp"
+#include "Collision/Collision.hpp"
+#include "Graphics/Animation-Internal.hpp"
 #include "Graphics/Renderer-Internal.hpp"
+#include "Graphics/SpriteSheet.hpp"
+#include "World/EntityStorage.hpp"
+
+static std::vector<uint32_t> finishedAnimations;
+
+bool BaseObject::hitboxesFrozen = false;
 
 void BaseObject::setShader(const std::string& shader)
 {
@@ -16,82 +24,45 @@ void BaseObject::setShader(const std::string& shader)
 
 void BaseObject::setSprite(const std::string& spriteName)
 {
-    std::string jsonFilePath = "./assets/Sprites/" + spriteName + ".json";
-    std::string pngFilePath = "./assets/Sprites/" + spriteName + ".png";
-
-    textureID = Renderer::loadTexture(spriteName, pngFilePath);
-
-    currentAnimation.start = 0;
-    currentAnimation.end = 0;
-    currentAnimation.direction = AnimationDirection::none;
-    animations.insert({"no_animation", currentAnimation});
-
-    std::ifstream jsonFile(jsonFilePath);
-
-    if (jsonFile.fail()) return;
-
-    nlohmann::json spriteData = nlohmann::json::parse(jsonFile);
+    spriteSheet = SpriteSheet::load(spriteName);
+    textureID = spriteSheet->textureID;
+
+    AnimationState& state = animationData();
+    state.id = AnimationId();
+    state.animation = FrameTag();
+    state.frames = spriteSheet->frames;
+    Animation::start(state);
+}
 
-    for (const nlohmann::json& spriteFrameJson : spriteData["frames"])
+void BaseObject::setAnimation(const std::string& animationName)
+{
+    if (!playAnimation(AnimationId(animationName)))
     {
-        SpriteFrame spriteFrame;
-        spriteFrame.x = spriteFrameJson["frame"]["x"].get<int>();
-        spriteFrame.y = spriteFrameJson["frame"]["y"].get<int>();
-        spriteFrame.w = spriteFrameJson["frame"]["w"].get<int>();
-        spriteFrame.h = spriteFrameJson["frame"]["h"].get<int>();
-        spriteFrame.duration = spriteFrameJson["duration"].get<int>();
-
-        frames.push_back(spriteFrame);
+        Log::write("Sprite", LogLevel::warning, "Animation: %s not found", animationName.c_str());
     }
+}
 
-    for (const nlohmann::json& frameTagJson : spriteData["meta"]["frameTags"])
+void BaseObject::setAnimation(const AnimationId animation)
+{
+    if (!playAnimation(animation))
     {
-        FrameTag frameTag;
-        frameTag.start = frameTagJson["from"].get<int>();
-        frameTag.end = frameTagJson["to"].get<int>();
-
-        if (std::string direction = frameTagJson["direction"].get<std::string>(); direction == "forward")
-        {
-            frameTag.direction = AnimationDirection::forward;
-        }
-        else if (direction == "reverse")
-        {
-            frameTag.direction = AnimationDirection::reverse;
-        }
-        else if (direction == "pingpong")
-        {
-            frameTag.direction = AnimationDirection::pingPong;
-        }
-
-        animations.insert({frameTagJson["name"].get<std::string>(), frameTag});
+        Log::write("Sprite", LogLevel::warning, "Animation: %08x not found", animation.value);
     }
 }
 
-void BaseObject::setAnimation(const std::string& animationName)
+void BaseObject::setAnimationSpeed(const float speed)
 {
-    if (currentAnimationName == animationName) return;
+    animationData().speed = speed;
+}
 
-    if (animations.contains(animationName))
-    {
-        currentAnimation = animations.at(animationName);
-    }
-    else
-    {
-        Log::write("Sprite", LogLevel::warning, "Animation: %s not found", animationName.c_str());
-    }
+float BaseObject::getAnimationSpeed() const
+{
+    return storage ? storage->animations[storageIndex].speed : animationState.speed;
+}
 
-    if (currentAnimation.direction == AnimationDirection::reverse)
-    {
-        currentAnimationDirection = AnimationDirection::reverse;
-        currentSprite = currentAnimation.end;
-    }
-    else
-    {
-        currentAnimationDirection = AnimationDirection::forward;
-        currentSprite = currentAnimation.start;
-    }
-    currentAnimationName = animationName;
-    frameStartTime = Bee::getTime();
+bool BaseObject::isAnimationFinished() const
+{
+    return storage ? storage->animations[storageIndex].finished : animationState.finished;
 }
 
 void BaseObject::setText(const std::string& text, const std::string& font, int fontSize, const Color& color)
@@ -119,7 +90,7 @@ void BaseObject::setText(const std::string& text, const std::string& font, int f
 
 void BaseObject::setScale(const Vector2f& scale)
 {
-    this->scale = scale;
+    scaleData() = scale;
 }
 
 void BaseObject::setHitboxScale(const float scale)
@@ -127,128 +98,230 @@ void BaseObject::setHitboxScale(const float scale)
     const Vector2f textureSize = getTextureSize();
     this->hitboxScale.x = textureSize.x / textureSize.y * scale;
     this->hitboxScale.y = scale;
+    hitboxDirty = true;
 }
 
 void BaseObject::setHitboxScale(const Vector2f& scale)
 {
     hitboxScale = scale;
+    hitboxDirty = true;
+}
+
+void BaseObject::setHitbox(const Hitbox& hitbox)
+{
+    localHitbox = hitbox;
+    customHitbox = true;
+    hitboxDirty = true;
+}
+
+void BaseObject::setRotation(const float rotation)
+{
+    rotationData() = rotation;
+    hitboxDirty = true;
 }
 
 void BaseObject::setPosition(const Vector2f& position)
 {
-    this->position.x = position.x;
-    this->position.y = position.y;
+    positionData().x = position.x;
+    positionData().y = position.y;
+    hitboxDirty = true;
 }
 
 void BaseObject::setPosition(const Vector3f& position)
 {
-    this->position = position;
+    positionData() = position;
+    hitboxDirty = true;
 }
 
 void BaseObject::setPositionZ(float z)
 {
-    position.z = z;
+    positionData().z = z;
 }
 
 void BaseObject::moveOffset(const Vector2f& offset)
 {
-    position.x += offset.x;
-    position.y += offset.y;
+    positionData().x += offset.x;
+    positionData().y += offset.y;
+    hitboxDirty = true;
 }
 
 Vector3f BaseObject::getPosition() const
 {
-    return position;
+    return positionData();
 }
 
 Vector2f BaseObject::getScale() const
 {
-    return scale;
+    return scaleData();
+}
+
+float BaseObject::getRotation() const
+{
+    return rotationData();
 }
 
 Vector2i BaseObject::getTextureSize() const
 {
     Vector2f textureSize;
 
-    if (frames.empty())
+    if (!spriteSheet || spriteSheet->frames.empty())
     {
         textureSize = Renderer::getTextureSize(textureID);
     }
     else
     {
-        textureSize.x = frames[0].w;
-        textureSize.y = frames[0].h;
+        textureSize.x = spriteSheet->frames[0].w;
+        textureSize.y = spriteSheet->frames[0].h;
     }
 
     return textureSize;
 }
 
-Hitbox BaseObject::getHitBox() const
+const Hitbox& BaseObject::getHitBox() const
 {
-    Hitbox hitbox;
-    const float c = cosf(0.0f * std::numbers::pi_v<float> / 180.0f);
-    const float s = sinf(0.0f * std::numbers::pi_v<float> / 180.0f);
-    
-    hitbox.center = position;
-    hitbox.vertices.emplace_back(position.x - hitboxScale.x / 2.0f * c - hitboxScale.y / 2.0f * s, position.y - hitboxScale.x / 2.0f * s + hitboxScale.y / 2.0f * c);
-    hitbox.vertices.emplace_back(position.x - hitboxScale.x / 2.0f * c + hitboxScale.y / 2.0f * s, position.y - hitboxScale.x / 2.0f * s - hitboxScale.y / 2.0f * c);
-    hitbox.vertices.emplace_back(position.x + hitboxScale.x / 2.0f * c - hitboxScale.y / 2.0f * s, position.y + hitboxScale.x / 2.0f * s + hitboxScale.y / 2.0f * c);
-    hitbox.vertices.emplace_back(position.x + hitboxScale.x / 2.0f * c + hitboxScale.y / 2.0f * s, position.y + hitboxScale.x / 2.0f * s - hitboxScale.y / 2.0f * c);
-
+    if (!hitboxesFrozen && hitboxDirty) updateHitbox();
     return hitbox;
 }
 
-void BaseObject::update()
+const AABB& BaseObject::getAABB() const
 {
-    if (frames.empty() || currentAnimation.direction == AnimationDirection::none)
-        return;
+    if (!hitboxesFrozen && hitboxDirty) updateHitbox();
+    return aabb;
+}
 
-    if (const uint32_t currentTime = Bee::getTime(); frameStartTime + frames[currentSprite].duration <= currentTime)
-    {
-        frameStartTime = currentTime;
+bool BaseObject::playAnimation(const AnimationId animation)
+{
+    AnimationState& state = animationData();
 
-        if (currentAnimationDirection == AnimationDirection::forward)
-        {
-            currentSprite++;
-        }
-        else
+    if (state.id == animation && !state.finished) return true;
+
+    bool found = false;
+
+    if (spriteSheet)
+    {
+        if (const auto it = spriteSheet->animations.find(animation.value); it != spriteSheet->animations.end())
         {
-            currentSprite--;
+            state.animation = it->second;
+            found = true;
         }
+    }
+
+    state.id = animation;
+    Animation::start(state);
+
+    return found;
+}
+
+Vector3f& BaseObject::positionData()
+{
+    if (!storage) return position;
+
+    storage->boundsDirty[storageIndex] = true;
+    return storage->positions[storageIndex];
+}
+
+const Vector3f& BaseObject::positionData() const
+{
+    return storage ? storage->positions[storageIndex] : position;
+}
+
+Vector2f& BaseObject::scaleData()
+{
+    if (!storage) return scale;
+
+    storage->boundsDirty[storageIndex] = true;
+    return storage->scales[storageIndex];
+}
+
+const Vector2f& BaseObject::scaleData() const
+{
+    return storage ? storage->scales[storageIndex] : scale;
+}
+
+float& BaseObject::rotationData()
+{
+    if (!storage) return rotation;
+
+    storage->boundsDirty[storageIndex] = true;
+    return storage->rotations[storageIndex];
+}
+
+float BaseObject::rotationData() const
+{
+    return storage ? storage->rotations[storageIndex] : rotation;
+}
 
-        switch (currentAnimationDirection)
+AnimationState& BaseObject::animationData()
+{
+    return storage ? storage->animations[storageIndex] : animationState;
+}
+
+void BaseObject::updateHitbox() const
+{
+    const float rotation = rotationData();
+    const float c = cosf(Math::radians(rotation));
+    const float s = sinf(Math::radians(rotation));
+    const Vector2f center = positionData();
+
+    auto transform = [&](const Vector2f& localPoint)
+    {
+        const Vector2f point = localPoint * hitboxScale;
+        return center + Vector2f(point.x * c - point.y * s, point.x * s + point.y * c);
+    };
+
+    if (!customHitbox)
+    {
+        hitbox.center = center;
+        hitbox.shape = rotation == 0.0f ? HitboxShape::aabb : HitboxShape::obb;
+        hitbox.vertices.resize(4);
+        hitbox.vertices[0] = transform({-0.5f, -0.5f});
+        hitbox.vertices[1] = transform({0.5f, -0.5f});
+        hitbox.vertices[2] = transform({0.5f, 0.5f});
+        hitbox.vertices[3] = transform({-0.5f, 0.5f});
+    }
+    else if (localHitbox.shape == HitboxShape::ellipse)
+    {
+        const Vector2f& axis = localHitbox.ellipseAxis;
+        hitbox.center = transform(localHitbox.center);
+        hitbox.shape = HitboxShape::ellipse;
+        hitbox.ellipse = localHitbox.ellipse * hitboxScale;
+        hitbox.ellipseAxis = {axis.x * c - axis.y * s, axis.x * s + axis.y * c};
+        hitbox.vertices.clear();
+    }
+    else
+    {
+        hitbox.center = transform(localHitbox.center);
+        hitbox.shape = localHitbox.shape == HitboxShape::aabb && rotation != 0.0f ? HitboxShape::obb : localHitbox.shape;
+        hitbox.vertices.resize(localHitbox.vertices.size());
+
+        for (size_t i = 0; i < localHitbox.vertices.size(); i++)
         {
-            case AnimationDirection::forward:
-                if (currentSprite > currentAnimation.end)
-                {
-                    currentSprite = currentAnimation.start;
-                }
-                break;
-            case AnimationDirection::reverse:
-                if (currentSprite < currentAnimation.start)
-                {
-                    currentSprite = currentAnimation.end;
-                }
-                break;
-            case AnimationDirection::pingPong:
-                if (currentSprite >= currentAnimation.end && currentAnimationDirection == AnimationDirection::forward)
-                {
-                    currentAnimationDirection = AnimationDirection::reverse;
-                }
-                else if (currentSprite <= currentAnimation.start && currentAnimationDirection == AnimationDirection::reverse)
-                {
-                    currentAnimationDirection = AnimationDirection::forward;
-                }
-                break;
-            case AnimationDirection::reversePingPong:
-                
-            default:
-                break;
+            hitbox.vertices[i] = transform(localHitbox.vertices[i]);
         }
     }
+
+    aabb = Collision::getBounds(hitbox);
+    hitboxDirty = false;
+}
+
+void BaseObject::update()
+{
+    if (storage) return;
+
+    finishedAnimations.clear();
+    Animation::advance({&animationState, 1}, Bee::getDeltaTime() * 1000.0f, finishedAnimations);
+
+    if (!finishedAnimations.empty())
+    {
+        onAnimationFinished(animationState.id);
+    }
 }
 
 void BaseObject::onDraw()
 {
     
 }
+
+void BaseObject::onAnimationFinished(AnimationId)
+{
+}
@@ -4,6 +4,7 @@
 #include <SDL2/SDL.h>
 
 #include "Audio-Internal.hpp"
+#include "FrameAllocator.hpp"
 #include "Graphics/Renderer-Internal.hpp"
 #include "Input/Controller-Internal.hpp"
 #include "Input/Keyboard-Internal.hpp"
@@ -117,6 +118,7 @@ static void mainLoop()
     currentWorld->World::update();
     currentWorld->update();
     Renderer::update();
+    FrameAllocator::endFrame();
     Controller::update();
     Keyboard::update();
     Mouse::update();
@@ -155,6 +157,12 @@ uint32_t Bee::getTime()
     return currentTime;
 }
 
+size_t Bee::getFrameMemoryHighWaterMark()
+{
+    return FrameAllocator::getHighWaterMark();
+}
+
+
 void Bee::setWorld(World* world)
 {
     nextWorld = world;
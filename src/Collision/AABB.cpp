@@ -0,0 +1,11 @@
+#include "Bee/Collision/AABB.hpp"
+
+bool AABB::overlaps(const AABB& other) const
+{
+    return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y;
+}
+
+bool AABB::contains(const Vector2f& point) const
+{
+    return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y;
+}
\ No newline at end of file
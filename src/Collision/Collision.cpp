@@ -1,14 +1,19 @@
 #include "Collision.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cfloat>
 #include <cmath>
-#include <vector>
 
 #include "Bee/Collision/Hitbox.hpp"
 #include "Bee/Collision/Intersection.hpp"
 #include "Bee/Math/Vector2f.hpp"
 
 static const Vector2f origin(0, 0);
+static constexpr size_t maxPolytopeSize = 50;
+
+HitboxView::HitboxView(const Hitbox& hitbox)
+    : center(hitbox.center), vertices(hitbox.vertices), shape(hitbox.shape), ellipse(hitbox.ellipse), ellipseAxis(hitbox.ellipseAxis) {}
 
 Vector2f tripleProduct(const Vector2f& in1, const Vector2f& in2, const Vector2f& in3)
 {
@@ -34,19 +39,32 @@ Vector2f tripleProduct(const Vector2f& in1, const Vector2f& in2, const Vector2f&
     return {out2X, out2Y};
 }
 
-Vector2f supportPointEllipse(const Hitbox& hitbox, Vector2f& directionVector)
+Vector2f supportPointEllipse(const HitboxView& hitbox, const Vector2f& directionVector)
 {
-    directionVector.normalize();
-    return hitbox.center + hitbox.ellipse * directionVector;
+    const Vector2f axisX = hitbox.ellipseAxis;
+    const Vector2f axisY(-axisX.y, axisX.x);
+    const Vector2f localDirection(directionVector.dot(axisX), directionVector.dot(axisY));
+    const Vector2f weightedDirection = hitbox.ellipse * hitbox.ellipse * localDirection;
+    const float length = sqrtf(weightedDirection.dot(localDirection));
+
+    if (length <= 0) return hitbox.center;
+
+    const Vector2f localPoint = weightedDirection / length;
+    return hitbox.center + axisX * localPoint.x + axisY * localPoint.y;
 }
 
-Vector2f supportPoint(const Hitbox& hitbox, Vector2f& directionVector)
+Vector2f supportPoint(const HitboxView& hitbox, const Vector2f& directionVector)
 {
-    if (hitbox.isEllipse)
+    if (hitbox.shape == HitboxShape::ellipse)
     {
         return supportPointEllipse(hitbox, directionVector);
     }
 
+    if (hitbox.shape == HitboxShape::point)
+    {
+        return hitbox.center;
+    }
+
     float largestDotProduct = -FLT_MAX;
     Vector2f supportPoint;
 
@@ -62,25 +80,30 @@ Vector2f supportPoint(const Hitbox& hitbox, Vector2f& directionVector)
     return supportPoint;
 }
 
-Vector2f minkowskiPoint(const Hitbox& hitbox1, const Hitbox& hitbox2, Vector2f& directionVector)
+Vector2f minkowskiPoint(const HitboxView& hitbox1, const HitboxView& hitbox2, const Vector2f& directionVector)
 {
-    Vector2f oppositeDirection = directionVector * -1;
-    return supportPoint(hitbox1, directionVector) - supportPoint(hitbox2, oppositeDirection);
+    return supportPoint(hitbox1, directionVector) - supportPoint(hitbox2, -directionVector);
 }
 
-void expandingPolytopeAlgorithm(Intersection& intersection, std::vector<Vector2f>& polytope, const Hitbox& hitbox1, const Hitbox& hitbox2)
+void expandingPolytopeAlgorithm(Intersection& intersection, const std::array<Vector2f, 3>& simplex, const HitboxView& hitbox1, const HitboxView& hitbox2)
 {
+    std::array<Vector2f, maxPolytopeSize> polytope;
+    size_t polytopeSize = simplex.size();
+    std::ranges::copy(simplex, polytope.begin());
+
     float minDistance = FLT_MAX;
-    int minIndex = 0;
+    size_t minIndex = 0;
     Vector2f minNormal;
 
     intersection.mtv = {0, 0};
 
-    while (polytope.size() < 50)
+    while (true)
     {
-        for (size_t i = 0; i < polytope.size(); i++)
+        minDistance = FLT_MAX;
+
+        for (size_t i = 0; i < polytopeSize; i++)
         {
-            const size_t j = (i + 1) % polytope.size();
+            const size_t j = (i + 1) % polytopeSize;
 
             Vector2f pointI = polytope[i];
             Vector2f pointJ = polytope[j];
@@ -111,25 +134,29 @@ void expandingPolytopeAlgorithm(Intersection& intersection, std::vector<Vector2f
             }
         }
 
+        if (polytopeSize == maxPolytopeSize) break;
+
         Vector2f support = minkowskiPoint(hitbox1, hitbox2, minNormal);
 
         if (fabsf(minNormal.dot(support) - minDistance) < 0.0001f) break;
 
-        minDistance = FLT_MAX;
-        polytope.insert(polytope.begin() + minIndex, support);
+        std::copy_backward(polytope.begin() + minIndex, polytope.begin() + polytopeSize, polytope.begin() + polytopeSize + 1);
+        polytope[minIndex] = support;
+        polytopeSize++;
     }
 
     intersection.penetrationDepth = minDistance;
     intersection.mtv = minNormal * minDistance * -1;
 }
 
-bool Collision::checkCollision(const Hitbox& hitbox1, const Hitbox& hitbox2, Intersection& intersection)
+bool gilbertJohnsonKeerthi(const HitboxView& hitbox1, const HitboxView& hitbox2, Intersection& intersection)
 {
-    std::vector<Vector2f> simplex;
+    std::array<Vector2f, 3> simplex;
+    size_t simplexSize = 0;
 
     Vector2f currentDirection(-1, 0);
 
-    simplex.push_back(minkowskiPoint(hitbox1, hitbox2, currentDirection));
+    simplex[simplexSize++] = minkowskiPoint(hitbox1, hitbox2, currentDirection);
 
     currentDirection = origin - simplex[0];
 
@@ -140,9 +167,9 @@ bool Collision::checkCollision(const Hitbox& hitbox1, const Hitbox& hitbox2, Int
         {
             return false;
         }
-        simplex.push_back(pointA);
+        simplex[simplexSize++] = pointA;
 
-        if (simplex.size() == 2)
+        if (simplexSize == 2)
         {
             Vector2f directionAB = simplex[0] - simplex[1];
             Vector2f directionAO = origin - simplex[1];
@@ -161,17 +188,393 @@ bool Collision::checkCollision(const Hitbox& hitbox1, const Hitbox& hitbox2, Int
         if (orthogonalAB.dot(lineAO) > 0)
         {
             currentDirection = orthogonalAB;
-            simplex.erase(simplex.begin());
+            simplex[0] = simplex[1];
+            simplex[1] = simplex[2];
+            simplexSize = 2;
             continue;
         }
         if (orthogonalAC.dot(lineAO) > 0)
         {
             currentDirection = orthogonalAC;
-            simplex.erase(simplex.begin() + 1);
+            simplex[1] = simplex[2];
+            simplexSize = 2;
             continue;
         }
 
         expandingPolytopeAlgorithm(intersection, simplex, hitbox1, hitbox2);
         return true;
     }
+}
+
+static bool isCircle(const HitboxView& hitbox)
+{
+    return hitbox.shape == HitboxShape::point || (hitbox.shape == HitboxShape::ellipse && hitbox.ellipse.x == hitbox.ellipse.y);
+}
+
+static bool isBox(const HitboxView& hitbox)
+{
+    return hitbox.shape == HitboxShape::aabb || hitbox.shape == HitboxShape::point || (hitbox.shape == HitboxShape::obb && hitbox.vertices.size() == 4);
+}
+
+static float circleRadius(const HitboxView& hitbox)
+{
+    return hitbox.shape == HitboxShape::ellipse ? hitbox.ellipse.x : 0.0f;
+}
+
+static void setResult(Intersection& intersection, const Vector2f& normal, const float depth)
+{
+    intersection.penetrationDepth = depth;
+    intersection.mtv = normal * depth;
+}
+
+static bool aabbCollision(const AABB& box1, const AABB& box2, Intersection& intersection)
+{
+    if (!box1.overlaps(box2)) return false;
+
+    const float left = box1.max.x - box2.min.x;
+    const float right = box2.max.x - box1.min.x;
+    const float up = box1.max.y - box2.min.y;
+    const float down = box2.max.y - box1.min.y;
+
+    const float depthX = std::min(left, right);
+    const float depthY = std::min(up, down);
+
+    if (depthX < depthY)
+    {
+        setResult(intersection, {left < right ? -1.0f : 1.0f, 0.0f}, depthX);
+    }
+    else
+    {
+        setResult(intersection, {0.0f, up < down ? -1.0f : 1.0f}, depthY);
+    }
+
+    return true;
+}
+
+static bool circleCollision(const HitboxView& circle1, const HitboxView& circle2, Intersection& intersection)
+{
+    const Vector2f distanceVector = circle1.center - circle2.center;
+    const float radii = circleRadius(circle1) + circleRadius(circle2);
+    const float distance = distanceVector.getLength();
+
+    if (distance > radii) return false;
+
+    const Vector2f normal = distance > 0 ? distanceVector / distance : Vector2f(1, 0);
+    setResult(intersection, normal, radii - distance);
+    return true;
+}
+
+static bool circleAABBCollision(const HitboxView& circle, const AABB& box, Intersection& intersection)
+{
+    const float radius = circleRadius(circle);
+    const Vector2f& center = circle.center;
+
+    if (box.contains(center))
+    {
+        const float left = center.x - box.min.x;
+        const float right = box.max.x - center.x;
+        const float up = center.y - box.min.y;
+        const float down = box.max.y - center.y;
+        const float depth = std::min({left, right, up, down});
+
+        if (depth == left) setResult(intersection, {-1, 0}, depth + radius);
+        else if (depth == right) setResult(intersection, {1, 0}, depth + radius);
+        else if (depth == up) setResult(intersection, {0, -1}, depth + radius);
+        else setResult(intersection, {0, 1}, depth + radius);
+
+        return true;
+    }
+
+    const Vector2f closestPoint(std::clamp(center.x, box.min.x, box.max.x), std::clamp(center.y, box.min.y, box.max.y));
+    const Vector2f distanceVector = center - closestPoint;
+    const float distance = distanceVector.getLength();
+
+    if (distance > radius) return false;
+
+    setResult(intersection, distanceVector / distance, radius - distance);
+    return true;
+}
+
+static void project(const HitboxView& hitbox, const Vector2f& axis, float& min, float& max)
+{
+    if (hitbox.shape == HitboxShape::point)
+    {
+        min = max = hitbox.center.dot(axis);
+        return;
+    }
+
+    min = FLT_MAX;
+    max = -FLT_MAX;
+
+    for (const Vector2f& vertex : hitbox.vertices)
+    {
+        const float projection = vertex.dot(axis);
+        min = std::min(min, projection);
+        max = std::max(max, projection);
+    }
+}
+
+static bool testAxes(const HitboxView& axesHitbox, const HitboxView& hitbox1, const HitboxView& hitbox2, float& minDepth, Vector2f& minNormal)
+{
+    if (axesHitbox.shape == HitboxShape::point) return true;
+
+    std::array<Vector2f, 2> axes = {Vector2f(1, 0), Vector2f(0, 1)};
+
+    if (axesHitbox.shape == HitboxShape::obb)
+    {
+        for (size_t i = 0; i < axes.size(); i++)
+        {
+            const Vector2f edge = axesHitbox.vertices[i + 1] - axesHitbox.vertices[i];
+            axes[i] = {-edge.y, edge.x};
+            axes[i].normalize();
+        }
+    }
+
+    for (const Vector2f& axis : axes)
+    {
+
+        float min1, max1, min2, max2;
+        project(hitbox1, axis, min1, max1);
+        project(hitbox2, axis, min2, max2);
+
+        if (max1 < min2 || max2 < min1) return false;
+
+        const float depthNegative = max1 - min2;
+        const float depthPositive = max2 - min1;
+
+        if (depthNegative < minDepth)
+        {
+            minDepth = depthNegative;
+            minNormal = -axis;
+        }
+        if (depthPositive < minDepth)
+        {
+            minDepth = depthPositive;
+            minNormal = axis;
+        }
+    }
+
+    return true;
+}
+
+static bool boxCollision(const HitboxView& hitbox1, const HitboxView& hitbox2, Intersection& intersection)
+{
+    float minDepth = FLT_MAX;
+    Vector2f minNormal;
+
+    if (!testAxes(hitbox1, hitbox1, hitbox2, minDepth, minNormal)) return false;
+    if (!testAxes(hitbox2, hitbox1, hitbox2, minDepth, minNormal)) return false;
+
+    setResult(intersection, minNormal, minDepth);
+    return true;
+}
+
+bool Collision::checkCollision(const HitboxView& hitbox1, const HitboxView& hitbox2, Intersection& intersection)
+{
+    const bool isAABB1 = hitbox1.shape == HitboxShape::aabb || hitbox1.shape == HitboxShape::point;
+    const bool isAABB2 = hitbox2.shape == HitboxShape::aabb || hitbox2.shape == HitboxShape::point;
+
+    intersection.mtv = {0, 0};
+
+    if (isAABB1 && isAABB2)
+    {
+        return aabbCollision(getBounds(hitbox1), getBounds(hitbox2), intersection);
+    }
+
+    if (isCircle(hitbox1) && isCircle(hitbox2))
+    {
+        return circleCollision(hitbox1, hitbox2, intersection);
+    }
+
+    if (isCircle(hitbox1) && isAABB2)
+    {
+        return circleAABBCollision(hitbox1, getBounds(hitbox2), intersection);
+    }
+
+    if (isAABB1 && isCircle(hitbox2))
+    {
+        const bool collision = circleAABBCollision(hitbox2, getBounds(hitbox1), intersection);
+        intersection.mtv = -intersection.mtv;
+        return collision;
+    }
+
+    if (isBox(hitbox1) && isBox(hitbox2))
+    {
+        return boxCollision(hitbox1, hitbox2, intersection);
+    }
+
+    return gilbertJohnsonKeerthi(hitbox1, hitbox2, intersection);
+}
+
+static Vector2f closestPointOnSegment(const Vector2f& pointA, const Vector2f& pointB, size_t& keep)
+{
+    const Vector2f lineAB = pointB - pointA;
+    const float lengthSquared = lineAB.dot(lineAB);
+    const float t = lengthSquared > 0 ? -pointA.dot(lineAB) / lengthSquared : 0.0f;
+
+    if (t <= 0)
+    {
+        keep = 0;
+        return pointA;
+    }
+    if (t >= 1)
+    {
+        keep = 1;
+        return pointB;
+    }
+
+    keep = 2;
+    return pointA + lineAB * t;
+}
+
+static float separation(const HitboxView& hitbox1, const Vector2f& offset, const HitboxView& hitbox2, Vector2f& closestPoint)
+{
+    static constexpr int maxIterations = 32;
+
+    std::array<Vector2f, 3> simplex;
+    size_t simplexSize = 1;
+
+    simplex[0] = minkowskiPoint(hitbox1, hitbox2, {1, 0}) + offset;
+    closestPoint = simplex[0];
+
+    for (int i = 0; i < maxIterations; i++)
+    {
+        const float distanceSquared = closestPoint.dot(closestPoint);
+        if (distanceSquared <= FLT_EPSILON) return 0.0f;
+
+        const Vector2f pointW = minkowskiPoint(hitbox1, hitbox2, -closestPoint) + offset;
+        if (distanceSquared - closestPoint.dot(pointW) <= distanceSquared * 0.0001f) break;
+
+        simplex[simplexSize++] = pointW;
+
+        if (simplexSize == 2)
+        {
+            size_t keep;
+            closestPoint = closestPointOnSegment(simplex[0], simplex[1], keep);
+
+            if (keep != 2)
+            {
+                simplex[0] = simplex[keep];
+                simplexSize = 1;
+            }
+            continue;
+        }
+
+        const float area = (simplex[1] - simplex[0]).x * (simplex[2] - simplex[0]).y - (simplex[1] - simplex[0]).y * (simplex[2] - simplex[0]).x;
+        bool inside = area != 0;
+        float minDistance = FLT_MAX;
+        std::array<Vector2f, 2> minEdge;
+
+        for (size_t j = 0; j < 3; j++)
+        {
+            const Vector2f& pointA = simplex[j];
+            const Vector2f& pointB = simplex[(j + 1) % 3];
+
+            if (((pointB - pointA).x * -pointA.y - (pointB - pointA).y * -pointA.x) * area < 0) inside = false;
+
+            size_t keep;
+            const Vector2f point = closestPointOnSegment(pointA, pointB, keep);
+
+            if (const float distance = point.dot(point); distance < minDistance)
+            {
+                minDistance = distance;
+                closestPoint = point;
+                minEdge = {keep == 1 ? pointB : pointA, pointB};
+                simplexSize = keep == 2 ? 2 : 1;
+            }
+        }
+
+        if (inside) return 0.0f;
+
+        simplex[0] = minEdge[0];
+        simplex[1] = minEdge[1];
+    }
+
+    return closestPoint.getLength();
+}
+
+bool Collision::castShape(const HitboxView& hitbox1, const Vector2f& displacement, const HitboxView& hitbox2, float& time, Vector2f& normal)
+{
+    static constexpr int maxIterations = 32;
+    static constexpr float targetSeparation = 0.001f;
+
+    Vector2f closestPoint;
+    float t = 0.0f;
+
+    for (int i = 0; i < maxIterations; i++)
+    {
+        const float distance = separation(hitbox1, displacement * t, hitbox2, closestPoint);
+
+        if (distance == 0.0f)
+        {
+            if (t > 0.0f)
+            {
+                time = t;
+                return true;
+            }
+
+            Intersection intersection;
+            checkCollision(hitbox1, hitbox2, intersection);
+            normal = intersection.mtv;
+            normal.normalize();
+            time = 0.0f;
+            return true;
+        }
+
+        normal = closestPoint / distance;
+
+        const float approachSpeed = -displacement.dot(normal);
+
+        if (distance <= targetSeparation && (t > 0.0f || approachSpeed > 0.0f))
+        {
+            time = t;
+            return true;
+        }
+
+        if (approachSpeed <= 0.0f) return false;
+
+        t += (distance - targetSeparation * 0.5f) / approachSpeed;
+        if (t > 1.0f) return false;
+    }
+
+    return false;
+}
+
+AABB Collision::getBounds(const HitboxView& hitbox)
+{
+    AABB bounds;
+
+    if (hitbox.shape == HitboxShape::ellipse)
+    {
+        const Vector2f& axis = hitbox.ellipseAxis;
+        const Vector2f extent
+        (
+            sqrtf(hitbox.ellipse.x * axis.x * hitbox.ellipse.x * axis.x + hitbox.ellipse.y * axis.y * hitbox.ellipse.y * axis.y),
+            sqrtf(hitbox.ellipse.x * axis.y * hitbox.ellipse.x * axis.y + hitbox.ellipse.y * axis.x * hitbox.ellipse.y * axis.x)
+        );
+
+        bounds.min = hitbox.center - extent;
+        bounds.max = hitbox.center + extent;
+        return bounds;
+    }
+
+    if (hitbox.shape == HitboxShape::point)
+    {
+        bounds.min = hitbox.center;
+        bounds.max = hitbox.center;
+        return bounds;
+    }
+
+    bounds.min = {FLT_MAX, FLT_MAX};
+    bounds.max = {-FLT_MAX, -FLT_MAX};
+
+    for (const Vector2f& vertex : hitbox.vertices)
+    {
+        bounds.min.x = std::min(bounds.min.x, vertex.x);
+        bounds.min.y = std::min(bounds.min.y, vertex.y);
+        bounds.max.x = std::max(bounds.max.x, vertex.x);
+        bounds.max.y = std::max(bounds.max.y, vertex.y);
+    }
+
+    return bounds;
 }
\ No newline at end of file
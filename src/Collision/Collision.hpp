@@ -1,9 +1,28 @@
 #pragma once
 
+#include <span>
+#include <vector>
+
+#include "Bee/Collision/AABB.hpp"
 #include "Bee/Collision/Hitbox.hpp"
 #include "Bee/Collision/Intersection.hpp"
 
+struct HitboxView
+{
+    Vector2f center;
+    std::span<const Vector2f> vertices;
+    HitboxShape shape = HitboxShape::polygon;
+    Vector2f ellipse;
+    Vector2f ellipseAxis = {1.0f, 0.0f};
+
+    HitboxView() = default;
+    HitboxView(const Hitbox& hitbox);
+};
+
 namespace Collision
 {
-    bool checkCollision(const Hitbox& hitbox1, const Hitbox& hitbox2, Intersection& intersection);
-}
+    bool checkCollision(const HitboxView& hitbox1, const HitboxView& hitbox2, Intersection& intersection);
+    bool castShape(const HitboxView& hitbox1, const Vector2f& displacement, const HitboxView& hitbox2, float& time, Vector2f& normal);
+    AABB getBounds(const HitboxView& hitbox);
+    bool decompose(std::span<const Vector2f> polygon, std::vector<Vector2f>& vertices, std::vector<size_t>& offsets);
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+#include "Bee/Collision/CollisionFilter.hpp"
+
+bool CollisionFilter::shouldCollide(const CollisionFilter& other) const
+{
+    return (category & other.mask) && (other.category & mask);
+}
\ No newline at end of file
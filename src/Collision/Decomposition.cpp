@@ -0,0 +1,163 @@
+#include "Collision.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+static constexpr float epsilon = 1e-6f;
+
+static float cross(const Vector2f& point1, const Vector2f& point2, const Vector2f& point3)
+{
+    return (point2.x - point1.x) * (point3.y - point1.y) - (point2.y - point1.y) * (point3.x - point1.x);
+}
+
+static bool isConvex(std::span<const Vector2f> polygon, const std::vector<int>& indices)
+{
+    const size_t size = indices.size();
+
+    for (size_t i = 0; i < size; i++)
+    {
+        const Vector2f& point1 = polygon[indices[i]];
+        const Vector2f& point2 = polygon[indices[(i + 1) % size]];
+        const Vector2f& point3 = polygon[indices[(i + 2) % size]];
+
+        if (cross(point1, point2, point3) < -epsilon) return false;
+    }
+
+    return true;
+}
+
+static bool isInTriangle(const Vector2f& point1, const Vector2f& point2, const Vector2f& point3, const Vector2f& point)
+{
+    return cross(point1, point2, point) >= 0.0f && cross(point2, point3, point) >= 0.0f && cross(point3, point1, point) >= 0.0f;
+}
+
+static bool triangulate(std::span<const Vector2f> polygon, std::vector<int> remaining, std::vector<std::vector<int>>& parts)
+{
+    while (remaining.size() > 3)
+    {
+        const size_t size = remaining.size();
+        bool clipped = false;
+
+        for (size_t i = 0; i < size && !clipped; i++)
+        {
+            const int previous = remaining[(i + size - 1) % size];
+            const int current = remaining[i];
+            const int next = remaining[(i + 1) % size];
+
+            if (cross(polygon[previous], polygon[current], polygon[next]) <= epsilon) continue;
+
+            const bool ear = std::ranges::none_of(remaining, [&](const int index)
+            {
+                return index != previous && index != current && index != next
+                    && isInTriangle(polygon[previous], polygon[current], polygon[next], polygon[index]);
+            });
+
+            if (!ear) continue;
+
+            parts.push_back({previous, current, next});
+            remaining.erase(remaining.begin() + static_cast<long>(i));
+            clipped = true;
+        }
+
+        for (size_t i = 0; i < size && !clipped; i++)
+        {
+            const int previous = remaining[(i + size - 1) % size];
+            const int next = remaining[(i + 1) % size];
+
+            if (std::abs(cross(polygon[previous], polygon[remaining[i]], polygon[next])) > epsilon) continue;
+
+            remaining.erase(remaining.begin() + static_cast<long>(i));
+            clipped = true;
+        }
+
+        if (!clipped) return false;
+    }
+
+    parts.push_back(std::move(remaining));
+    return true;
+}
+
+static bool mergeParts(std::span<const Vector2f> polygon, std::vector<std::vector<int>>& parts)
+{
+    std::vector<int> merged;
+
+    for (size_t a = 0; a < parts.size(); a++)
+    {
+        for (size_t b = a + 1; b < parts.size(); b++)
+        {
+            const std::vector<int>& part1 = parts[a];
+            const std::vector<int>& part2 = parts[b];
+
+            for (size_t i = 0; i < part1.size(); i++)
+            {
+                for (size_t j = 0; j < part2.size(); j++)
+                {
+                    if (part1[i] != part2[(j + 1) % part2.size()] || part1[(i + 1) % part1.size()] != part2[j]) continue;
+
+                    merged.clear();
+
+                    for (size_t k = 1; k <= part1.size(); k++)
+                    {
+                        merged.push_back(part1[(i + k) % part1.size()]);
+                    }
+
+                    for (size_t k = 2; k < part2.size(); k++)
+                    {
+                        merged.push_back(part2[(j + k) % part2.size()]);
+                    }
+
+                    if (!isConvex(polygon, merged)) continue;
+
+                    parts[a] = merged;
+                    parts.erase(parts.begin() + static_cast<long>(b));
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+bool Collision::decompose(std::span<const Vector2f> polygon, std::vector<Vector2f>& vertices, std::vector<size_t>& offsets)
+{
+    vertices.clear();
+    offsets.clear();
+
+    if (polygon.size() < 4) return true;
+
+    float area = 0.0f;
+
+    for (size_t i = 0; i < polygon.size(); i++)
+    {
+        const Vector2f& point1 = polygon[i];
+        const Vector2f& point2 = polygon[(i + 1) % polygon.size()];
+        area += point1.x * point2.y - point2.x * point1.y;
+    }
+
+    std::vector<int> indices(polygon.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    if (area < 0.0f) std::ranges::reverse(indices);
+
+    if (isConvex(polygon, indices)) return true;
+
+    std::vector<std::vector<int>> parts;
+    if (!triangulate(polygon, indices, parts)) return false;
+
+    while (mergeParts(polygon, parts)) {}
+
+    offsets.push_back(0);
+
+    for (const std::vector<int>& part : parts)
+    {
+        for (const int index : part)
+        {
+            vertices.push_back(polygon[index]);
+        }
+
+        offsets.push_back(vertices.size());
+    }
+
+    return true;
+}
\ No newline at end of file
@@ -1,18 +1,28 @@
 #include "Bee/Entity.hpp"
 
+#include <cmath>
+
 #include "Bee/Bee.hpp"
 #include "Collision/Collision.hpp"
-#include "Graphics/Rect.hpp"
-#include "Graphics/Renderer-Internal.hpp"
 
 bool Entity::isCursorOnMe() const
 {
-    Hitbox hitbox;
+    const Vector2f cursorPosition = Mouse::getMouseWorldPosition();
+    HitboxView cursor;
     Intersection intersection;
 
-    hitbox.vertices.push_back(Mouse::getMouseWorldPosition());
+    if (!getAABB().contains(cursorPosition)) return false;
+
+    cursor.shape = HitboxShape::point;
+    cursor.center = cursorPosition;
+    cursor.vertices = {&cursorPosition, 1};
 
-    return Collision::checkCollision(getHitBox(), hitbox, intersection);
+    return Collision::checkCollision(getHitBox(), cursor, intersection);
+}
+
+EntityHandle Entity::getHandle() const
+{
+    return handle;
 }
 
 std::vector<Intersection> Entity::getIntersections() const
@@ -20,11 +30,128 @@ std::vector<Intersection> Entity::getIntersections() const
     return Bee::getCurrentWorld()->getIntersections(this);
 }
 
+CastResult Entity::castShape(const Vector2f& displacement) const
+{
+    return Bee::getCurrentWorld()->castShape(getHitBox(), displacement, this, collisionFilter);
+}
+
+const std::string& Entity::getName() const
+{
+    return name;
+}
+
+void Entity::setName(const std::string& name)
+{
+    if (world)
+    {
+        world->setEntityName(this, name);
+    }
+    else
+    {
+        this->name = name;
+    }
+}
+
+uint32_t Entity::getTags() const
+{
+    return tags;
+}
+
+void Entity::setTags(const uint32_t tags)
+{
+    if (world)
+    {
+        world->setEntityTags(this, tags);
+    }
+    else
+    {
+        this->tags = tags;
+    }
+}
+
+bool Entity::hasTags(const uint32_t tags) const
+{
+    return (this->tags & tags) == tags;
+}
+
+MoveResult Entity::moveAndSlide(const Vector2f& displacement, const Vector2f& up, const float maxSlopeAngle)
+{
+    return Bee::getCurrentWorld()->moveAndSlide(this, displacement, up, maxSlopeAngle);
+}
+
+const CollisionFilter& Entity::getCollisionFilter() const
+{
+    return collisionFilter;
+}
+
+void Entity::setCollisionFilter(const CollisionFilter& filter)
+{
+    collisionFilter = filter;
+}
+
+bool Entity::hasCollisionEvents() const
+{
+    return collisionEvents;
+}
+
+void Entity::setCollisionEvents(const bool enabled)
+{
+    collisionEvents = enabled;
+}
+
+UpdatePolicy Entity::getUpdatePolicy() const
+{
+    return updatePolicy;
+}
+
+void Entity::setUpdatePolicy(const UpdatePolicy policy)
+{
+    updatePolicy = policy;
+}
+
+float Entity::getUpdateDeltaTime() const
+{
+    return updateDeltaTime;
+}
+
+bool Entity::isSleeping() const
+{
+    return sleeping;
+}
+
+void Entity::sleep(const float wakeDistance)
+{
+    sleeping = true;
+    this->wakeDistance = wakeDistance;
+}
+
+void Entity::wake()
+{
+    sleeping = false;
+}
+
+bool Entity::hasParallelUpdate() const
+{
+    return parallelUpdate;
+}
+
+void Entity::setParallelUpdate(const bool enabled)
+{
+    parallelUpdate = enabled;
+}
+
+void Entity::requestPath(const Vector2i& to, const uint32_t blockingFlags, const PathAlgorithm algorithm)
+{
+    const Vector3f position = getPosition();
+    const Vector2i from(static_cast<int>(std::floor(position.x)), static_cast<int>(std::floor(position.y)));
+    Bee::getCurrentWorld()->requestPath(this, from, to, blockingFlags, algorithm);
+}
+
 void Entity::setScale(const float scale)
 {
     const Vector2f textureSize = getTextureSize();
-    this->scale.x = textureSize.x / textureSize.y * scale;
-    this->scale.y = scale;
+    scaleData().x = textureSize.x / textureSize.y * scale;
+    scaleData().y = scale;
 }
 
 void Entity::setSprite(const std::string& spriteName)
@@ -41,23 +168,43 @@ void Entity::setText(const std::string& text, const std::string& font, int fontS
 
 void Entity::update()
 {
-    Rect rect;
 
-    if (frames.empty())
-    {
-        Vector2i textureSize = getTextureSize();
-        rect.x = 0;
-        rect.y = 0;
-        rect.w = textureSize.x;
-        rect.h = textureSize.y;
-    }
-    else
-    {
-        rect.x = frames.at(currentSprite).x;
-        rect.y = frames.at(currentSprite).y;
-        rect.w = frames.at(currentSprite).w;
-        rect.h = frames.at(currentSprite).h;
-    }
+}
 
-    Renderer::queueEntity(position, scale, shaderID, textureID, rect, this);
+void Entity::updateParallel()
+{
+
+}
+
+void Entity::onCollisionEnter(const Intersection&)
+{
+}
+
+void Entity::onCollisionStay(const Intersection&)
+{
+}
+
+void Entity::onCollisionExit(const Intersection&)
+{
+}
+
+void Entity::onTriggerEnter(const Intersection&)
+{
+}
+
+void Entity::onTriggerStay(const Intersection&)
+{
+}
+
+void Entity::onTriggerExit(const Intersection&)
+{
 }
+
+void Entity::onPathResult(const std::vector<Vector2i>&)
+{
+}
+
+void Entity::onSpawn()
+{
+
+}
\ No newline at end of file
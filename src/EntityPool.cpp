@@ -0,0 +1,66 @@
+#include "Bee/EntityPool.hpp"
+
+#include "Graphics/Renderer-Internal.hpp"
+#include "Graphics/SpriteSheet.hpp"
+
+EntityPoolBase::EntityPoolBase(const Prefab& prefab)
+    : prefab(prefab)
+{
+    if (!prefab.sprite.empty())
+    {
+        spriteSheet = SpriteSheet::load(prefab.sprite);
+    }
+
+    if (!prefab.shader.empty())
+    {
+        shaderID = Renderer::loadShader(prefab.shader);
+    }
+
+    if (!prefab.animation.empty())
+    {
+        animation = AnimationId(prefab.animation);
+    }
+}
+
+EntityPoolBase::~EntityPoolBase() = default;
+
+const Prefab& EntityPoolBase::getPrefab() const
+{
+    return prefab;
+}
+
+void EntityPoolBase::prepare(Entity* entity)
+{
+    entity->pool = this;
+    entity->storage = nullptr;
+    entity->storageIndex = 0;
+    entity->shaderID = shaderID;
+    entity->spriteSheet = spriteSheet;
+    entity->textureID = spriteSheet ? spriteSheet->textureID : 0;
+    entity->position = {};
+    entity->rotation = 0.0f;
+    entity->hitboxScale = {1.0f, 1.0f};
+    entity->customHitbox = false;
+    entity->hitboxDirty = true;
+
+    entity->animationState = AnimationState();
+    if (spriteSheet) entity->animationState.frames = spriteSheet->frames;
+
+    entity->setScale(prefab.scale);
+    if (prefab.hitbox) entity->setHitbox(*prefab.hitbox);
+    if (!prefab.animation.empty()) entity->setAnimation(animation);
+
+    entity->collisionFilter = prefab.collisionFilter;
+    entity->collisionEvents = prefab.collisionEvents;
+    entity->parallelUpdate = false;
+    entity->sleeping = false;
+    entity->updatePolicy = UpdatePolicy::always;
+    entity->wakeDistance = 0.0f;
+    entity->accumulatedTime = 0.0f;
+    entity->updateDeltaTime = 0.0f;
+    entity->slideContacts.clear();
+    entity->name = prefab.name;
+    entity->tags = prefab.tags;
+
+    entity->onSpawn();
+}
\ No newline at end of file
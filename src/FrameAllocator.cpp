@@ -0,0 +1,119 @@
+#include "FrameAllocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <new>
+
+static constexpr size_t initialArenaSize = 256 * 1024;
+
+FrameArena::FrameArena(const size_t initialSize)
+{
+    addBlock(initialSize);
+}
+
+void FrameArena::reset()
+{
+    if (blocks.size() > 1)
+    {
+        const size_t capacity = getCapacity();
+        blocks.clear();
+        addBlock(capacity);
+    }
+
+    offset = 0;
+    used = 0;
+}
+
+size_t FrameArena::getUsed() const
+{
+    return used;
+}
+
+size_t FrameArena::getCapacity() const
+{
+    size_t capacity = 0;
+
+    for (const Block& block : blocks)
+    {
+        capacity += block.size;
+    }
+
+    return capacity;
+}
+
+void FrameArena::addBlock(const size_t size)
+{
+    blocks.push_back({std::make_unique_for_overwrite<std::byte[]>(size), size});
+    offset = 0;
+}
+
+void* FrameArena::do_allocate(const size_t bytes, const size_t alignment)
+{
+    Block* block = &blocks.back();
+    void* pointer = block->data.get() + offset;
+    size_t space = block->size - offset;
+
+    if (!std::align(alignment, bytes, pointer, space))
+    {
+        addBlock(std::max(block->size * 2, bytes + alignment));
+        block = &blocks.back();
+        pointer = block->data.get();
+        space = block->size;
+        std::align(alignment, bytes, pointer, space);
+    }
+
+    const size_t start = static_cast<std::byte*>(pointer) - block->data.get();
+    used += start + bytes - offset;
+    offset = start + bytes;
+
+    return pointer;
+}
+
+void FrameArena::do_deallocate(void*, size_t, size_t)
+{
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+static std::array<FrameArena, 2> arenas = {FrameArena(initialArenaSize), FrameArena(initialArenaSize)};
+static size_t currentArena = 0;
+static size_t highWaterMark = 0;
+
+class FrameResource final : public std::pmr::memory_resource
+{
+    void* do_allocate(const size_t bytes, const size_t alignment) override
+    {
+        return arenas[currentArena].allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override
+    {
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+static FrameResource frameResource;
+
+std::pmr::memory_resource* FrameAllocator::get()
+{
+    return &frameResource;
+}
+
+void FrameAllocator::endFrame()
+{
+    highWaterMark = std::max(highWaterMark, arenas[currentArena].getUsed());
+    currentArena = (currentArena + 1) % arenas.size();
+    arenas[currentArena].reset();
+}
+
+size_t FrameAllocator::getHighWaterMark()
+{
+    return std::max(highWaterMark, arenas[currentArena].getUsed());
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+class FrameArena final : public std::pmr::memory_resource
+{
+public:
+    explicit FrameArena(size_t initialSize);
+    void reset();
+    size_t getUsed() const;
+    size_t getCapacity() const;
+
+private:
+    struct Block
+    {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    size_t offset = 0;
+    size_t used = 0;
+
+    void addBlock(size_t size);
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+namespace FrameAllocator
+{
+    std::pmr::memory_resource* get();
+    void endFrame();
+    size_t getHighWaterMark();
+}
\ No newline at end of file
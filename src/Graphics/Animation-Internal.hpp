@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Bee/Graphics/Animation.hpp"
+
+namespace Animation
+{
+    void start(AnimationState& state);
+    void advance(std::span<AnimationState> states, float delta, std::vector<uint32_t>& finished);
+}
\ No newline at end of file
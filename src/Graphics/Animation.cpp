@@ -0,0 +1,80 @@
+#include "Graphics/Animation-Internal.hpp"
+
+#include <algorithm>
+
+void Animation::start(AnimationState& state)
+{
+    const FrameTag& animation = state.animation;
+
+    if (animation.direction == AnimationDirection::reverse || animation.direction == AnimationDirection::reversePingPong)
+    {
+        state.direction = AnimationDirection::reverse;
+        state.sprite = animation.end;
+    }
+    else
+    {
+        state.direction = AnimationDirection::forward;
+        state.sprite = animation.start;
+    }
+
+    state.elapsed = 0.0f;
+    state.loops = 0;
+    state.finished = false;
+}
+
+void Animation::advance(const std::span<AnimationState> states, const float delta, std::vector<uint32_t>& finished)
+{
+    for (uint32_t i = 0; i < states.size(); i++)
+    {
+        AnimationState& state = states[i];
+        const FrameTag& animation = state.animation;
+
+        if (state.frames.empty() || animation.direction == AnimationDirection::none || state.finished)
+            continue;
+
+        state.elapsed += delta * state.speed;
+
+        while (!state.finished)
+        {
+            const float duration = static_cast<float>(std::max(state.frames[state.sprite].duration, 1));
+            if (state.elapsed < duration) break;
+
+            state.elapsed -= duration;
+            const int step = state.direction == AnimationDirection::forward ? 1 : -1;
+            int sprite = state.sprite + step;
+
+            if (sprite >= animation.start && sprite <= animation.end)
+            {
+                state.sprite = sprite;
+                continue;
+            }
+
+            state.loops++;
+            finished.push_back(i);
+
+            if (animation.repeat > 0 && state.loops >= static_cast<uint32_t>(animation.repeat))
+            {
+                state.finished = true;
+                state.elapsed = 0.0f;
+                break;
+            }
+
+            switch (animation.direction)
+            {
+                case AnimationDirection::pingPong:
+                case AnimationDirection::reversePingPong:
+                    state.direction = step > 0 ? AnimationDirection::reverse : AnimationDirection::forward;
+                    sprite = std::clamp(state.sprite - step, animation.start, animation.end);
+                    break;
+                case AnimationDirection::reverse:
+                    sprite = animation.end;
+                    break;
+                default:
+                    sprite = animation.start;
+                    break;
+            }
+
+            state.sprite = sprite;
+        }
+    }
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "Bee/Graphics/HUDObject.hpp"
 
+#include <array>
+
 #include "Bee/Input/Mouse.hpp"
 #include "Bee/Math/Vector2i.hpp"
 #include "Collision/Collision.hpp"
@@ -8,20 +10,28 @@
 
 bool HUDObject::isCursorOnMe() const
 {
-    Hitbox hitbox;
-    Hitbox cursor;
+    std::array<Vector2f, 4> vertices;
+    HitboxView hitbox;
+    HitboxView cursor;
     Intersection intersection;
+    const Vector3f& position = positionData();
+    const Vector2f& scale = scaleData();
     const Vector2f center = static_cast<Vector2i>(position) + scale / 2;
-    const Vector2i cursorPosition = Mouse::getMouseScreenPosition();
+    const Vector2f cursorPosition = Mouse::getMouseScreenPosition();
     const float c = cosf(0.0f * std::numbers::pi_v<float> / 180.0f);
     const float s = sinf(0.0f * std::numbers::pi_v<float> / 180.0f);
 
-    hitbox.vertices.emplace_back(center.x - scale.x / 2.0f * c - scale.y / 2.0f * s, center.y - scale.x / 2.0f * s + scale.y / 2.0f * c);
-    hitbox.vertices.emplace_back(center.x + scale.x / 2.0f * c - scale.y / 2.0f * s, center.y + scale.x / 2.0f * s + scale.y / 2.0f * c);
-    hitbox.vertices.emplace_back(center.x - scale.x / 2.0f * c + scale.y / 2.0f * s, center.y - scale.x / 2.0f * s - scale.y / 2.0f * c);
-    hitbox.vertices.emplace_back(center.x + scale.x / 2.0f * c + scale.y / 2.0f * s, center.y + scale.x / 2.0f * s - scale.y / 2.0f * c);
+    vertices[0] = {center.x - scale.x / 2.0f * c - scale.y / 2.0f * s, center.y - scale.x / 2.0f * s + scale.y / 2.0f * c};
+    vertices[1] = {center.x + scale.x / 2.0f * c - scale.y / 2.0f * s, center.y + scale.x / 2.0f * s + scale.y / 2.0f * c};
+    vertices[2] = {center.x - scale.x / 2.0f * c + scale.y / 2.0f * s, center.y - scale.x / 2.0f * s - scale.y / 2.0f * c};
+    vertices[3] = {center.x + scale.x / 2.0f * c + scale.y / 2.0f * s, center.y + scale.x / 2.0f * s - scale.y / 2.0f * c};
 
-    cursor.vertices.emplace_back(cursorPosition.x, cursorPosition.y);
+    hitbox.shape = HitboxShape::aabb;
+    hitbox.center = center;
+    hitbox.vertices = vertices;
+    cursor.shape = HitboxShape::point;
+    cursor.center = cursorPosition;
+    cursor.vertices = {&cursorPosition, 1};
 
     return Collision::checkCollision(hitbox, cursor, intersection);
 }
@@ -29,7 +39,7 @@ bool HUDObject::isCursorOnMe() const
 void HUDObject::setScale(const float scale)
 {
     const Vector2i textureSize = getTextureSize();
-    this->scale = textureSize * scale;
+    scaleData() = textureSize * scale;
 }
 
 void HUDObject::setSprite(const std::string& spriteName)
@@ -46,9 +56,17 @@ void HUDObject::setText(const std::string& text, const std::string& font, int fo
 
 void HUDObject::update()
 {
+
+}
+
+bool HUDObject::queue()
+{
+    if (!textureID) return false;
+
     Rect rect;
+    const AnimationState& state = animationData();
 
-    if (frames.empty())
+    if (state.frames.empty())
     {
         Vector2i textureSize = getTextureSize();
         rect.x = 0;
@@ -58,11 +76,13 @@ void HUDObject::update()
     }
     else
     {
-        rect.x = frames.at(currentSprite).x;
-        rect.y = frames.at(currentSprite).y;
-        rect.w = frames.at(currentSprite).w;
-        rect.h = frames.at(currentSprite).h;
+        const SpriteFrame& frame = state.frames[state.sprite];
+        rect.x = frame.x;
+        rect.y = frame.y;
+        rect.w = frame.w;
+        rect.h = frame.h;
     }
 
-    Renderer::queueHUD(position, scale, shaderID, textureID, rect, this);
+    Renderer::queueHUD(positionData(), scaleData(), shaderID, textureID, rect, this);
+    return true;
 }
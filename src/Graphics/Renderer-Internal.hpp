@@ -17,7 +17,8 @@ namespace Renderer
     void handleEvent(const SDL_Event* event);
     void queueTile(const Vector3f& position, int textureID, const Rect& rect);
     void queueHUD(const Vector3f& position, const Vector2f& scale, int shaderID, int textureID, const Rect& rect, HUDObject* hudObject);
-    void queueEntity(const Vector3f& position, const Vector2f& scale, int shaderID, int textureID, const Rect& rect, Entity* entity);
+    void queueEntity(const Vector3f& position, const Vector2f& scale, float rotation, int shaderID, int textureID, const Rect& rect, Entity* entity);
+    void setQueueSequence(uint64_t sequence);
     int loadShader(const std::string& shader);
     int loadTexture(const std::string& textureName, const std::string& path);
     int createUniqueTexture(const SDL_Surface* surface);
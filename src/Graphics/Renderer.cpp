@@ -1,9 +1,13 @@
 #include "Bee/Graphics/Renderer.hpp"
 #include "Renderer-Internal.hpp"
 
+#include <algorithm>
 #include <cstdio>
 #include <filesystem>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
@@ -25,6 +29,92 @@ static std::unordered_map<std::string, int> textureCache;
 static std::unordered_set<int> uniqueTextures;
 static IRenderer* renderer = nullptr;
 
+enum class RenderCommandType
+{
+    tile,
+    entity,
+    hud,
+};
+
+struct RenderCommand
+{
+    RenderCommandType type;
+    uint64_t sequence;
+    Vector3f position;
+    Vector2f scale;
+    float rotation;
+    int shaderID;
+    int textureID;
+    Rect rect;
+    void* object;
+};
+
+struct RenderCommandBuffer
+{
+    std::vector<RenderCommand> commands;
+    uint64_t sequence = 0;
+};
+
+static std::mutex commandBufferMutex;
+static std::vector<std::unique_ptr<RenderCommandBuffer>> commandBuffers;
+static std::vector<RenderCommand> mergedCommands;
+static thread_local RenderCommandBuffer* commandBuffer = nullptr;
+
+static RenderCommandBuffer& getCommandBuffer()
+{
+    if (!commandBuffer)
+    {
+        std::lock_guard lock(commandBufferMutex);
+        commandBuffer = commandBuffers.emplace_back(std::make_unique<RenderCommandBuffer>()).get();
+    }
+
+    return *commandBuffer;
+}
+
+static void pushCommand(RenderCommand command)
+{
+    RenderCommandBuffer& buffer = getCommandBuffer();
+    command.sequence = buffer.sequence++;
+    buffer.commands.push_back(command);
+}
+
+static void submitCommands()
+{
+    mergedCommands.clear();
+
+    {
+        std::lock_guard lock(commandBufferMutex);
+
+        for (const std::unique_ptr<RenderCommandBuffer>& buffer : commandBuffers)
+        {
+            mergedCommands.insert(mergedCommands.end(), buffer->commands.begin(), buffer->commands.end());
+            buffer->commands.clear();
+            buffer->sequence = 0;
+        }
+    }
+
+    std::ranges::stable_sort(mergedCommands, [](const RenderCommand& a, const RenderCommand& b)
+    {
+        return std::tie(a.position.z, a.type, a.sequence) < std::tie(b.position.z, b.type, b.sequence);
+    });
+
+    for (const RenderCommand& command : mergedCommands)
+    {
+        switch (command.type)
+        {
+            case RenderCommandType::tile:
+                renderer->queueTile(command.position, command.textureID, command.rect);
+                break;
+            case RenderCommandType::entity:
+                renderer->queueEntity(command.position, command.scale, command.rotation, command.shaderID, command.textureID, command.rect, static_cast<Entity*>(command.object));
+                break;
+            case RenderCommandType::hud:
+                renderer->queueHUD(command.position, command.scale, command.shaderID, command.textureID, command.rect, static_cast<HUDObject*>(command.object));
+                break;
+        }
+    }
+}
+
 void Renderer::init(const int windowWidth, const int windowHeight)
 {
     if (SDL_InitSubSystem(SDL_INIT_VIDEO) < 0)
@@ -54,6 +144,7 @@ void Renderer::init(const int windowWidth, const int windowHeight)
 
 void Renderer::update()
 {
+    submitCommands();
     renderer->update();
 }
 
@@ -68,19 +159,24 @@ void Renderer::handleEvent(const SDL_Event* event)
 void Renderer::queueTile(const Vector3f& position, int textureID, const Rect& rect)
 {
     if (!textureID) return;
-    renderer->queueTile(position, textureID, rect);
+    pushCommand({RenderCommandType::tile, 0, position, {}, 0.0f, 0, textureID, rect, nullptr});
 }
 
 void Renderer::queueHUD(const Vector3f& position, const Vector2f& scale, int shaderID, int textureID, const Rect& rect, HUDObject* hudObject)
 {
     if (!textureID) return;
-    renderer->queueHUD(position, scale, shaderID, textureID, rect, hudObject);
+    pushCommand({RenderCommandType::hud, 0, position, scale, 0.0f, shaderID, textureID, rect, hudObject});
 }
 
-void Renderer::queueEntity(const Vector3f& position, const Vector2f& scale, int shaderID, int textureID, const Rect& rect, Entity* entity)
+void Renderer::queueEntity(const Vector3f& position, const Vector2f& scale, float rotation, int shaderID, int textureID, const Rect& rect, Entity* entity)
 {
     if (!textureID) return;
-    renderer->queueEntity(position, scale, shaderID, textureID, rect, entity);
+    pushCommand({RenderCommandType::entity, 0, position, scale, rotation, shaderID, textureID, rect, entity});
+}
+
+void Renderer::setQueueSequence(const uint64_t sequence)
+{
+    getCommandBuffer().sequence = sequence;
 }
 
 int Renderer::loadShader(const std::string& shader)
@@ -103,6 +199,7 @@ int Renderer::loadTexture(const std::string& textureName, const std::string& pat
     const int textureID = renderer->createTexture(surface);
     delete[] static_cast<unsigned char*>(surface->pixels);
     SDL_FreeSurface(surface);
+    textureCache[textureName] = textureID;
     return textureID;
 }
 
@@ -15,7 +15,7 @@ public:
     virtual void freeTexture(int textureID) = 0;
     virtual int loadShader(const std::string& shader) = 0;
     virtual void queueTile(const Vector3f& position, int textureID, const Rect& rect) = 0;
-    virtual void queueEntity(const Vector3f& position, const Vector2f& scale, int shaderID, int textureID, const Rect& rect, Entity* entity) = 0;
+    virtual void queueEntity(const Vector3f& position, const Vector2f& scale, float rotation, int shaderID, int textureID, const Rect& rect, Entity* entity) = 0;
     virtual void queueHUD(const Vector3f& position, const Vector2f& scale, int shaderID, int textureID, const Rect& rect, HUDObject* hudObject) = 0;
     virtual void resize(const Vector2i& size) = 0;
     virtual Vector2f getCameraPosition() = 0;
@@ -17,11 +17,13 @@
 #include <imgui_impl_opengl3.h>
 
 #include "Bee/Graphics/Window.hpp"
+#include "FrameAllocator.hpp"
 #include "Graphics/Window-Internal.hpp"
 #include "ErrorHandling.hpp"
 #include "BasicShader.hpp"
 
 OpenGL::OpenGL()
+    : layersToDraw(FrameAllocator::get())
 {
 #ifdef __EMSCRIPTEN__
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES);
@@ -60,6 +62,10 @@ OpenGL::OpenGL()
 
     quadIBO.init(indices, 6);
 
+    spriteLayout.push<float>(3);
+    spriteLayout.push<float>(2);
+    spriteLayout.push<float>(4);
+
     textures.emplace_back();
     shaders.emplace_back(basicShaderVertSrc, basicShaderFragSrc);
     shaders.emplace_back(tileShaderVertSrc, tileShaderFragSrc);
@@ -226,7 +232,7 @@ void OpenGL::queueTile(const Vector3f& position, const int textureID, const Rect
     Batch& batch = layersToDraw[position.z];
 
     const auto it = std::ranges::find(batch.tileBatchTextureIDs, textureID);
-    std::vector<std::array<Vertex, 4> >* vertices = nullptr;
+    std::pmr::vector<std::array<Vertex, 4> >* vertices = nullptr;
 
     if (it == batch.tileBatchTextureIDs.end())
     {
@@ -270,12 +276,13 @@ void OpenGL::queueTile(const Vector3f& position, const int textureID, const Rect
     });
 }
 
-void OpenGL::queueEntity(const Vector3f& position, const Vector2f& scale, int shaderID, const int textureID, const Rect& rect, Entity* entity)
+void OpenGL::queueEntity(const Vector3f& position, const Vector2f& scale, const float rotation, int shaderID, const int textureID, const Rect& rect, Entity* entity)
 {
     Batch& batch = layersToDraw[position.z];
 
     Matrix4f modelMatrix(1.0f);
     modelMatrix.scale(scale);
+    modelMatrix.rotate(Math::radians(rotation), {0.0f, 0.0f, 1.0f});
     modelMatrix.translate(position);
 
     const Vector2i textureSize = textures.at(textureID).getSize();
@@ -507,6 +514,11 @@ void OpenGL::setUniformMat4f(const std::string& name, const Matrix4f& matrix)
     currentShader->setUniformMat4f(name, matrix);
 }
 
+OpenGL::Batch::Batch(const allocator_type& allocator)
+    : tileBatchVertices(allocator), tileBatchTextureIDs(allocator), entitySprites(allocator), hudSprites(allocator)
+{
+}
+
 void OpenGL::renderEntities(const Batch& batch)
 {
     for (const Sprite& sprite: batch.entitySprites)
@@ -520,13 +532,8 @@ void OpenGL::renderEntities(const Batch& batch)
 
         VertexBuffer vbo(&sprite.vertices, sizeof(sprite.vertices));
 
-        VertexBufferLayout layout;
-        layout.push<float>(3);
-        layout.push<float>(2);
-        layout.push<float>(4);
-
         VertexArray vao;
-        vao.addBuffer(vbo, layout);
+        vao.addBuffer(vbo, spriteLayout);
 
         Entity* entity = static_cast<Entity*>(sprite.object);
         entity->onDraw();
@@ -548,13 +555,8 @@ void OpenGL::renderHUD(const Batch& batch)
 
         VertexBuffer vbo(&sprite.vertices, sizeof(sprite.vertices));
 
-        VertexBufferLayout layout;
-        layout.push<float>(3);
-        layout.push<float>(2);
-        layout.push<float>(4);
-
         VertexArray vao;
-        vao.addBuffer(vbo, layout);
+        vao.addBuffer(vbo, spriteLayout);
 
         HUDObject* hudObject = static_cast<HUDObject*>(sprite.object);
         hudObject->onDraw();
@@ -567,7 +569,8 @@ void OpenGL::renderTiles(const Batch& batch)
 {
     for (size_t i = 0; i < batch.tileBatchVertices.size(); i++)
     {
-        std::vector<int> indices;
+        std::pmr::vector<int> indices(FrameAllocator::get());
+        indices.reserve(batch.tileBatchVertices.at(i).size() * 6);
 
         for (size_t j = 0; j < batch.tileBatchVertices.at(i).size(); j++)
         {
@@ -592,13 +595,8 @@ void OpenGL::renderTiles(const Batch& batch)
 
         VertexBuffer vbo(batch.tileBatchVertices.at(i).data(), batch.tileBatchVertices.at(i).size() * sizeof(std::array<Vertex, 4>));
 
-        VertexBufferLayout layout;
-        layout.push<float>(3);
-        layout.push<float>(2);
-        layout.push<float>(4);
-
         VertexArray vao;
-        vao.addBuffer(vbo, layout);
+        vao.addBuffer(vbo, spriteLayout);
 
         draw(vao, ibo, shader);
     }
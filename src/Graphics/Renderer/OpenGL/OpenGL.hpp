@@ -2,6 +2,7 @@
 
 #include <array>
 #include <map>
+#include <memory_resource>
 #include <vector>
 
 #include <SDL2/SDL.h>
@@ -25,7 +26,7 @@ public:
     void freeTexture(int textureID) override;
     int loadShader(const std::string& shader) override;
     void queueTile(const Vector3f& position, int textureID, const Rect& rect) override;
-    void queueEntity(const Vector3f& position, const Vector2f& scale, int shaderID, int textureID, const Rect& rect, Entity* entity) override;
+    void queueEntity(const Vector3f& position, const Vector2f& scale, float rotation, int shaderID, int textureID, const Rect& rect, Entity* entity) override;
     void queueHUD(const Vector3f& position, const Vector2f& scale, int shaderID, int textureID, const Rect& rect, HUDObject* hudObject) override;
     void resize(const Vector2i& size) override;
     Vector2f getCameraPosition() override;
@@ -78,21 +79,26 @@ private:
 
     struct Batch
     {
-        std::vector<std::vector<std::array<Vertex, 4>>> tileBatchVertices;
-        std::vector<int> tileBatchTextureIDs;
+        using allocator_type = std::pmr::polymorphic_allocator<>;
 
-        std::vector<Sprite> entitySprites;
+        explicit Batch(const allocator_type& allocator);
 
-        std::vector<Sprite> hudSprites;
+        std::pmr::vector<std::pmr::vector<std::array<Vertex, 4>>> tileBatchVertices;
+        std::pmr::vector<int> tileBatchTextureIDs;
+
+        std::pmr::vector<Sprite> entitySprites;
+
+        std::pmr::vector<Sprite> hudSprites;
     };
 
-    std::map<float, Batch> layersToDraw;
+    std::pmr::map<float, Batch> layersToDraw;
 
     Matrix4f viewMatrix;
     Matrix4f worldProjectionMatrix;
     Matrix4f screenProjectionMatrix;
 
     IndexBuffer quadIBO;
+    VertexBufferLayout spriteLayout;
 
     void renderEntities(const Batch&);
     void renderHUD(const Batch&);
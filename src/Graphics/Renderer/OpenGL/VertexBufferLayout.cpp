@@ -54,7 +54,7 @@ void VertexBufferLayout::push<unsigned char>(unsigned int count)
     stride += VertexBufferElement::GetSizeOfType(GL_UNSIGNED_BYTE) * count;
 }
 
-std::vector<VertexBufferElement> VertexBufferLayout::getElements() const
+const std::vector<VertexBufferElement>& VertexBufferLayout::getElements() const
 {
     return elements;
 }
@@ -28,7 +28,7 @@ public:
     template<unsigned char>
     void push(unsigned int count);
 
-    std::vector<VertexBufferElement> getElements() const;
+    const std::vector<VertexBufferElement>& getElements() const;
 
     unsigned int getStride() const;
 
@@ -0,0 +1,91 @@
+#include "Graphics/SpriteSheet.hpp"
+
+#include <charconv>
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+#include "Bee/Log.hpp"
+#include "Graphics/Renderer-Internal.hpp"
+
+static std::unordered_map<std::string, std::weak_ptr<const SpriteSheet>> spriteSheets;
+
+std::shared_ptr<const SpriteSheet> SpriteSheet::load(const std::string& spriteName)
+{
+    if (const auto it = spriteSheets.find(spriteName); it != spriteSheets.end())
+    {
+        if (std::shared_ptr<const SpriteSheet> spriteSheet = it->second.lock())
+            return spriteSheet;
+    }
+
+    std::erase_if(spriteSheets, [](const auto& entry) { return entry.second.expired(); });
+
+    std::string jsonFilePath = "./assets/Sprites/" + spriteName + ".json";
+    std::string pngFilePath = "./assets/Sprites/" + spriteName + ".png";
+
+    auto spriteSheet = std::make_shared<SpriteSheet>();
+    spriteSheet->textureID = Renderer::loadTexture(spriteName, pngFilePath);
+    spriteSheet->animations.insert({"no_animation"_animation.value, FrameTag()});
+    spriteSheets[spriteName] = spriteSheet;
+
+    std::ifstream jsonFile(jsonFilePath);
+
+    if (jsonFile.fail()) return spriteSheet;
+
+    nlohmann::json spriteData = nlohmann::json::parse(jsonFile);
+
+    for (const nlohmann::json& spriteFrameJson : spriteData["frames"])
+    {
+        SpriteFrame spriteFrame;
+        spriteFrame.x = spriteFrameJson["frame"]["x"].get<int>();
+        spriteFrame.y = spriteFrameJson["frame"]["y"].get<int>();
+        spriteFrame.w = spriteFrameJson["frame"]["w"].get<int>();
+        spriteFrame.h = spriteFrameJson["frame"]["h"].get<int>();
+        spriteFrame.duration = spriteFrameJson["duration"].get<int>();
+
+        spriteSheet->frames.push_back(spriteFrame);
+    }
+
+    for (const nlohmann::json& frameTagJson : spriteData["meta"]["frameTags"])
+    {
+        FrameTag frameTag;
+        frameTag.start = frameTagJson["from"].get<int>();
+        frameTag.end = frameTagJson["to"].get<int>();
+
+        if (std::string direction = frameTagJson["direction"].get<std::string>(); direction == "forward")
+        {
+            frameTag.direction = AnimationDirection::forward;
+        }
+        else if (direction == "reverse")
+        {
+            frameTag.direction = AnimationDirection::reverse;
+        }
+        else if (direction == "pingpong")
+        {
+            frameTag.direction = AnimationDirection::pingPong;
+        }
+        else if (direction == "pingpong_reverse")
+        {
+            frameTag.direction = AnimationDirection::reversePingPong;
+        }
+
+        if (const nlohmann::json& repeat = frameTagJson.value("repeat", nlohmann::json()); repeat.is_string())
+        {
+            const std::string& text = repeat.get_ref<const std::string&>();
+            std::from_chars(text.data(), text.data() + text.size(), frameTag.repeat);
+        }
+        else if (repeat.is_number_integer())
+        {
+            frameTag.repeat = repeat.get<int>();
+        }
+
+        const std::string name = frameTagJson["name"].get<std::string>();
+
+        if (!spriteSheet->animations.insert({AnimationId(name).value, frameTag}).second)
+        {
+            Log::write("Sprite", LogLevel::warning, "Animation: %s in %s is not unique", name.c_str(), spriteName.c_str());
+        }
+    }
+
+    return spriteSheet;
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Bee/Graphics/Animation.hpp"
+
+struct SpriteSheet
+{
+    int textureID = 0;
+    std::vector<SpriteFrame> frames;
+    std::unordered_map<uint32_t, FrameTag> animations;
+
+    static std::shared_ptr<const SpriteSheet> load(const std::string& spriteName);
+};
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Bee/Entity.hpp"
+#include "Bee/Collision/AABB.hpp"
+#include "Bee/Collision/Intersection.hpp"
+#include "Bee/World/WorldObject.hpp"
+
+struct Contact
+{
+    Entity* entity;
+    Entity* otherEntity;
+    WorldObject* worldObject;
+    Intersection intersection;
+    uint64_t entityKey;
+    uint64_t otherKey;
+};
+
+struct ContactProxy
+{
+    AABB aabb;
+    Entity* entity;
+    WorldObject* worldObject;
+    uint64_t key;
+};
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+class Entity;
+
+struct EntitySlot
+{
+    Entity* entity = nullptr;
+    uint32_t generation = 0;
+    uint32_t index = 0;
+};
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "EntityStorage.hpp"
+
+#include <cmath>
+
+#include "Graphics/Animation-Internal.hpp"
+#include "Graphics/Rect.hpp"
+#include "Graphics/Renderer-Internal.hpp"
+
+void EntityStorage::add(Entity* entity)
+{
+    entity->storage = this;
+    entity->storageIndex = positions.size();
+
+    positions.push_back(entity->position);
+    scales.push_back(entity->scale);
+    rotations.push_back(entity->rotation);
+    animations.push_back(entity->animationState);
+    bounds.emplace_back();
+    boundsDirty.push_back(true);
+}
+
+void EntityStorage::remove(Entity* entity, Entity* last)
+{
+    const uint32_t index = entity->storageIndex;
+
+    entity->position = positions[index];
+    entity->scale = scales[index];
+    entity->rotation = rotations[index];
+    entity->animationState = animations[index];
+    entity->storage = nullptr;
+
+    positions[index] = positions.back();
+    scales[index] = scales.back();
+    rotations[index] = rotations.back();
+    animations[index] = animations.back();
+    bounds[index] = bounds.back();
+    boundsDirty[index] = boundsDirty.back();
+    last->storageIndex = index;
+
+    positions.pop_back();
+    scales.pop_back();
+    rotations.pop_back();
+    animations.pop_back();
+    bounds.pop_back();
+    boundsDirty.pop_back();
+}
+
+void EntityStorage::clear()
+{
+    positions.clear();
+    scales.clear();
+    rotations.clear();
+    animations.clear();
+    bounds.clear();
+    boundsDirty.clear();
+}
+
+AABB EntityStorage::getBounds(const size_t index) const
+{
+    if (!boundsDirty[index]) return bounds[index];
+
+    const Vector2f center = positions[index];
+    Vector2f extent = Vector2f(std::abs(scales[index].x), std::abs(scales[index].y)) / 2.0f;
+
+    if (rotations[index] != 0.0f)
+    {
+        extent = Vector2f(1.0f, 1.0f) * extent.getLength();
+    }
+
+    bounds[index] = {center - extent, center + extent};
+    boundsDirty[index] = false;
+    return bounds[index];
+}
+
+void EntityStorage::animate(const float delta)
+{
+    finishedAnimations.clear();
+    Animation::advance(animations, delta, finishedAnimations);
+}
+
+uint32_t EntityStorage::queue(const std::span<Entity* const> entities, const size_t begin, const size_t end, const AABB& viewport, uint32_t& culled) const
+{
+    uint32_t drawn = 0;
+    Renderer::setQueueSequence(begin);
+
+    for (size_t i = begin; i < end; i++)
+    {
+        const Entity* entity = entities[i];
+        if (!entity->textureID) continue;
+
+        if (!getBounds(i).overlaps(viewport))
+        {
+            culled++;
+            continue;
+        }
+
+        const AnimationState& animation = animations[i];
+        Rect rect;
+
+        if (animation.frames.empty())
+        {
+            const Vector2i textureSize = entity->getTextureSize();
+            rect.x = 0;
+            rect.y = 0;
+            rect.w = textureSize.x;
+            rect.h = textureSize.y;
+        }
+        else
+        {
+            const SpriteFrame& frame = animation.frames[animation.sprite];
+            rect.x = frame.x;
+            rect.y = frame.y;
+            rect.w = frame.w;
+            rect.h = frame.h;
+        }
+
+        Renderer::queueEntity(positions[i], scales[i], rotations[i], entity->shaderID, entity->textureID, rect, entities[i]);
+        drawn++;
+    }
+
+    return drawn;
+}
\ No newline at end of file
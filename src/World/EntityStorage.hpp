@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Bee/Entity.hpp"
+#include "Bee/Collision/AABB.hpp"
+
+struct EntityStorage
+{
+    std::vector<Vector3f> positions;
+    std::vector<Vector2f> scales;
+    std::vector<float> rotations;
+    std::vector<AnimationState> animations;
+    mutable std::vector<AABB> bounds;
+    mutable std::vector<uint8_t> boundsDirty;
+    std::vector<uint32_t> finishedAnimations;
+
+    void add(Entity* entity);
+    void remove(Entity* entity, Entity* last);
+    void clear();
+    AABB getBounds(size_t index) const;
+    void animate(float delta);
+    uint32_t queue(std::span<Entity* const> entities, size_t begin, size_t end, const AABB& viewport, uint32_t& culled) const;
+};
\ No newline at end of file
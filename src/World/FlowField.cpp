@@ -0,0 +1,281 @@
+#include "Bee/World/FlowField.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+static constexpr int offsetsX[] = {1, 1, 0, -1, -1, -1, 0, 1};
+static constexpr int offsetsY[] = {0, 1, 1, 1, 0, -1, -1, -1};
+static constexpr float costs[] = {1.0f, std::numbers::sqrt2_v<float>, 1.0f, std::numbers::sqrt2_v<float>, 1.0f, std::numbers::sqrt2_v<float>, 1.0f, std::numbers::sqrt2_v<float>};
+static constexpr uint8_t noDirection = 8;
+static constexpr float infinity = std::numeric_limits<float>::infinity();
+
+static const Vector2f directionVectors[] =
+{
+    {1.0f, 0.0f},
+    {std::numbers::sqrt2_v<float> / 2, std::numbers::sqrt2_v<float> / 2},
+    {0.0f, 1.0f},
+    {-std::numbers::sqrt2_v<float> / 2, std::numbers::sqrt2_v<float> / 2},
+    {-1.0f, 0.0f},
+    {-std::numbers::sqrt2_v<float> / 2, -std::numbers::sqrt2_v<float> / 2},
+    {0.0f, -1.0f},
+    {std::numbers::sqrt2_v<float> / 2, -std::numbers::sqrt2_v<float> / 2},
+    {0.0f, 0.0f},
+};
+
+const Vector2i& FlowField::getGoal() const
+{
+    return goal;
+}
+
+Vector2f FlowField::getDirection(const Vector2f& position) const
+{
+    const int cell = getCell(position);
+    if (cell < 0) return {0, 0};
+
+    return directionVectors[directions[cell]];
+}
+
+float FlowField::getDistance(const Vector2f& position) const
+{
+    const int cell = getCell(position);
+    if (cell < 0) return infinity;
+
+    return distances[cell];
+}
+
+int FlowField::getCell(const Vector2f& position) const
+{
+    const int x = static_cast<int>(std::floor(position.x));
+    const int y = static_cast<int>(std::floor(position.y));
+
+    if (x < 0 || y < 0 || x >= width || y >= height) return -1;
+
+    return x + y * width;
+}
+
+bool FlowField::isWalkable(std::span<const uint32_t> cellFlags, const int x, const int y) const
+{
+    return x >= 0 && y >= 0 && x < width && y < height && !(cellFlags[x + y * width] & blockingFlags);
+}
+
+bool FlowField::canMove(std::span<const uint32_t> cellFlags, const int index, const int direction) const
+{
+    const int x = index % width;
+    const int y = index / width;
+    const int dx = offsetsX[direction];
+    const int dy = offsetsY[direction];
+
+    if (!isWalkable(cellFlags, x + dx, y + dy)) return false;
+    if (dx != 0 && dy != 0) return isWalkable(cellFlags, x + dx, y) && isWalkable(cellFlags, x, y + dy);
+
+    return true;
+}
+
+void FlowField::build(std::span<const uint32_t> cellFlags, const int width, const int height, const Vector2i& goal, const uint32_t blockingFlags)
+{
+    this->width = width;
+    this->height = height;
+    this->goal = goal;
+    this->blockingFlags = blockingFlags;
+
+    distances.assign(static_cast<size_t>(width) * height, infinity);
+    directions.assign(static_cast<size_t>(width) * height, noDirection);
+    openList.clear();
+    changedCells.clear();
+
+    if (!isWalkable(cellFlags, goal.x, goal.y)) return;
+
+    const int goalIndex = goal.x + goal.y * width;
+    distances[goalIndex] = 0.0f;
+    openList.emplace_back(0.0f, goalIndex);
+    propagate(cellFlags);
+
+    for (int i = 0; i < width * height; i++)
+    {
+        updateDirection(cellFlags, i);
+    }
+
+    changedCells.clear();
+}
+
+void FlowField::updateCell(std::span<const uint32_t> cellFlags, const int x, const int y)
+{
+    const int index = x + y * width;
+
+    if (x == goal.x && y == goal.y)
+    {
+        build(cellFlags, width, height, goal, blockingFlags);
+        return;
+    }
+
+    openList.clear();
+    changedCells.clear();
+
+    if (isWalkable(cellFlags, x, y))
+    {
+        changedCells.push_back(index);
+        relax(cellFlags, index);
+
+        for (int direction = 0; direction < 8; direction++)
+        {
+            if (isWalkable(cellFlags, x + offsetsX[direction], y + offsetsY[direction]))
+            {
+                relax(cellFlags, x + offsetsX[direction] + (y + offsetsY[direction]) * width);
+            }
+        }
+
+        propagate(cellFlags);
+
+        const size_t changedCount = changedCells.size();
+
+        for (size_t i = 0; i < changedCount; i++)
+        {
+            const int changed = changedCells[i];
+            updateDirection(cellFlags, changed);
+
+            for (int direction = 0; direction < 8; direction++)
+            {
+                const int neighborX = changed % width + offsetsX[direction];
+                const int neighborY = changed / width + offsetsY[direction];
+
+                if (neighborX >= 0 && neighborY >= 0 && neighborX < width && neighborY < height)
+                {
+                    updateDirection(cellFlags, neighborX + neighborY * width);
+                }
+            }
+        }
+
+        return;
+    }
+
+    distances[index] = infinity;
+    directions[index] = noDirection;
+
+    for (int direction = 0; direction < 8; direction++)
+    {
+        const int neighborX = x + offsetsX[direction];
+        const int neighborY = y + offsetsY[direction];
+        if (neighborX < 0 || neighborY < 0 || neighborX >= width || neighborY >= height) continue;
+
+        const int neighbor = neighborX + neighborY * width;
+
+        if (directions[neighbor] != noDirection && !canMove(cellFlags, neighbor, directions[neighbor]))
+        {
+            distances[neighbor] = infinity;
+            changedCells.push_back(neighbor);
+        }
+    }
+
+    changedCells.push_back(index);
+
+    for (size_t i = 0; i < changedCells.size(); i++)
+    {
+        const int affected = changedCells[i];
+
+        for (int direction = 0; direction < 8; direction++)
+        {
+            const int neighborX = affected % width + offsetsX[direction];
+            const int neighborY = affected / width + offsetsY[direction];
+            if (neighborX < 0 || neighborY < 0 || neighborX >= width || neighborY >= height) continue;
+
+            const int neighbor = neighborX + neighborY * width;
+            const uint8_t neighborDirection = directions[neighbor];
+
+            if (neighborDirection != noDirection && distances[neighbor] != infinity
+                && neighborX + offsetsX[neighborDirection] == affected % width && neighborY + offsetsY[neighborDirection] == affected / width)
+            {
+                distances[neighbor] = infinity;
+                changedCells.push_back(neighbor);
+            }
+        }
+    }
+
+    const size_t affectedCount = changedCells.size();
+
+    for (size_t i = 0; i < affectedCount; i++)
+    {
+        directions[changedCells[i]] = noDirection;
+        relax(cellFlags, changedCells[i]);
+    }
+
+    propagate(cellFlags);
+
+    for (size_t i = 0; i < affectedCount; i++)
+    {
+        updateDirection(cellFlags, changedCells[i]);
+    }
+}
+
+void FlowField::relax(std::span<const uint32_t> cellFlags, const int index)
+{
+    if (!isWalkable(cellFlags, index % width, index / width)) return;
+
+    float distance = distances[index];
+
+    for (int direction = 0; direction < 8; direction++)
+    {
+        if (!canMove(cellFlags, index, direction)) continue;
+
+        const int neighbor = index + offsetsX[direction] + offsetsY[direction] * width;
+        distance = std::min(distance, distances[neighbor] + costs[direction]);
+    }
+
+    if (distance < distances[index])
+    {
+        distances[index] = distance;
+        openList.emplace_back(distance, index);
+        std::ranges::push_heap(openList, std::greater<>());
+    }
+}
+
+void FlowField::propagate(std::span<const uint32_t> cellFlags)
+{
+    while (!openList.empty())
+    {
+        std::ranges::pop_heap(openList, std::greater<>());
+        const auto [distance, index] = openList.back();
+        openList.pop_back();
+
+        if (distance > distances[index]) continue;
+
+        for (int direction = 0; direction < 8; direction++)
+        {
+            if (!canMove(cellFlags, index, direction)) continue;
+
+            const int neighbor = index + offsetsX[direction] + offsetsY[direction] * width;
+            const float neighborDistance = distance + costs[direction];
+
+            if (neighborDistance < distances[neighbor])
+            {
+                distances[neighbor] = neighborDistance;
+                openList.emplace_back(neighborDistance, neighbor);
+                std::ranges::push_heap(openList, std::greater<>());
+                changedCells.push_back(neighbor);
+            }
+        }
+    }
+}
+
+void FlowField::updateDirection(std::span<const uint32_t> cellFlags, const int index)
+{
+    directions[index] = noDirection;
+
+    if (distances[index] == infinity || distances[index] == 0.0f) return;
+
+    float bestDistance = infinity;
+
+    for (int direction = 0; direction < 8; direction++)
+    {
+        if (!canMove(cellFlags, index, direction)) continue;
+
+        const float distance = distances[index + offsetsX[direction] + offsetsY[direction] * width] + costs[direction];
+
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+            directions[index] = direction;
+        }
+    }
+}
\ No newline at end of file
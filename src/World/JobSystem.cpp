@@ -0,0 +1,134 @@
+#include "JobSystem.hpp"
+
+#include <algorithm>
+
+JobSystem::JobSystem(const unsigned int workerCount)
+{
+    for (unsigned int i = 0; i <= workerCount; i++)
+    {
+        queues.push_back(std::make_unique<Queue>());
+    }
+
+    for (unsigned int i = 1; i <= workerCount; i++)
+    {
+        workers.emplace_back(&JobSystem::work, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+
+    workAvailable.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void JobSystem::parallelFor(const size_t count, const size_t grainSize, const Job job, void* context)
+{
+    if (count == 0) return;
+
+    if (workers.empty() || count <= grainSize)
+    {
+        job(context, 0, count);
+        return;
+    }
+
+    this->job = job;
+    this->context = context;
+
+    const size_t rangeCount = (count + grainSize - 1) / grainSize;
+    remainingRanges = rangeCount;
+
+    for (size_t i = 0; i < rangeCount; i++)
+    {
+        Queue& queue = *queues[i % queues.size()];
+        std::lock_guard lock(queue.mutex);
+        queue.ranges.push_back({i * grainSize, std::min(count, (i + 1) * grainSize)});
+    }
+
+    {
+        std::lock_guard lock(mutex);
+        batch++;
+    }
+
+    workAvailable.notify_all();
+
+    while (runNext(0)) {}
+
+    std::unique_lock lock(mutex);
+    workFinished.wait(lock, [this] { return remainingRanges == 0; });
+}
+
+unsigned int JobSystem::getThreadCount() const
+{
+    return workers.size() + 1;
+}
+
+bool JobSystem::runNext(const unsigned int queueIndex)
+{
+    Range range;
+    bool found = false;
+
+    {
+        Queue& queue = *queues[queueIndex];
+        std::lock_guard lock(queue.mutex);
+
+        if (!queue.ranges.empty())
+        {
+            range = queue.ranges.back();
+            queue.ranges.pop_back();
+            found = true;
+        }
+    }
+
+    for (size_t i = 1; i < queues.size() && !found; i++)
+    {
+        Queue& queue = *queues[(queueIndex + i) % queues.size()];
+        std::lock_guard lock(queue.mutex);
+
+        if (!queue.ranges.empty())
+        {
+            range = queue.ranges.front();
+            queue.ranges.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found) return false;
+
+    job(context, range.begin, range.end);
+
+    if (remainingRanges.fetch_sub(1) == 1)
+    {
+        std::lock_guard lock(mutex);
+        workFinished.notify_all();
+    }
+
+    return true;
+}
+
+void JobSystem::work(const unsigned int queueIndex)
+{
+    uint64_t lastBatch = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock lock(mutex);
+            workAvailable.wait(lock, [&] { return stopping || batch != lastBatch; });
+
+            if (stopping) return;
+
+            lastBatch = batch;
+        }
+
+        while (runNext(queueIndex)) {}
+    }
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem
+{
+public:
+    using Job = void (*)(void* context, size_t begin, size_t end);
+
+    explicit JobSystem(unsigned int workerCount);
+    ~JobSystem();
+    void parallelFor(size_t count, size_t grainSize, Job job, void* context);
+    unsigned int getThreadCount() const;
+
+private:
+    struct Range
+    {
+        size_t begin;
+        size_t end;
+    };
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Range> ranges;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable workFinished;
+    Job job = nullptr;
+    void* context = nullptr;
+    std::atomic<size_t> remainingRanges = 0;
+    uint64_t batch = 0;
+    bool stopping = false;
+
+    bool runNext(unsigned int queueIndex);
+    void work(unsigned int queueIndex);
+};
\ No newline at end of file
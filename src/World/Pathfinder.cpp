@@ -0,0 +1,417 @@
+#include "Pathfinder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include "Bee/Entity.hpp"
+
+static constexpr float diagonalCost = std::numbers::sqrt2_v<float>;
+
+bool PathSearch::isWalkable(const int x, const int y) const
+{
+    return x >= 0 && y >= 0 && x < grid->width && y < grid->height && !(grid->cellFlags[x + y * grid->width] & blockingFlags);
+}
+
+float PathSearch::heuristic(const int index) const
+{
+    const int dx = std::abs(index % grid->width - goal.x);
+    const int dy = std::abs(index / grid->width - goal.y);
+    return static_cast<float>(std::max(dx, dy)) + (diagonalCost - 1.0f) * static_cast<float>(std::min(dx, dy));
+}
+
+void PathSearch::push(const int index, const int parent, const float cost)
+{
+    if (visited[index] == generation && costs[index] <= cost) return;
+
+    visited[index] = generation;
+    costs[index] = cost;
+    parents[index] = parent;
+    openList.emplace_back(cost + heuristic(index), index);
+    std::ranges::push_heap(openList, std::greater<>());
+}
+
+void PathSearch::findPath(const PathGrid& grid, const PathQuery& query, std::vector<Vector2i>& path)
+{
+    path.clear();
+
+    this->grid = &grid;
+    blockingFlags = query.blockingFlags;
+    goal = query.to;
+
+    if (query.from.x < 0 || query.from.y < 0 || query.from.x >= grid.width || query.from.y >= grid.height) return;
+    if (!isWalkable(goal.x, goal.y)) return;
+
+    const size_t size = static_cast<size_t>(grid.width) * grid.height;
+
+    if (visited.size() != size || ++generation == 0)
+    {
+        visited.assign(size, 0);
+        closed.assign(size, 0);
+        costs.resize(size);
+        parents.resize(size);
+        generation = 1;
+    }
+
+    const int start = query.from.x + query.from.y * grid.width;
+    const int target = goal.x + goal.y * grid.width;
+
+    openList.clear();
+    push(start, -1, 0.0f);
+
+    while (!openList.empty())
+    {
+        std::ranges::pop_heap(openList, std::greater<>());
+        const int index = openList.back().second;
+        openList.pop_back();
+
+        if (closed[index] == generation) continue;
+        closed[index] = generation;
+
+        if (index == target)
+        {
+            for (int node = target; node != -1; node = parents[node])
+            {
+                const Vector2i point(node % grid.width, node / grid.width);
+
+                if (!path.empty())
+                {
+                    const Vector2i step(std::clamp(path.back().x - point.x, -1, 1), std::clamp(path.back().y - point.y, -1, 1));
+
+                    for (Vector2i fill = path.back() - step; fill.x != point.x || fill.y != point.y; fill = fill - step)
+                    {
+                        path.push_back(fill);
+                    }
+                }
+
+                path.push_back(point);
+            }
+
+            std::ranges::reverse(path);
+            return;
+        }
+
+        if (query.algorithm == PathAlgorithm::aStar)
+        {
+            aStar(index);
+        }
+        else
+        {
+            jumpPointSearch(index);
+        }
+    }
+}
+
+void PathSearch::aStar(const int index)
+{
+    const int x = index % grid->width;
+    const int y = index / grid->width;
+
+    for (int dy = -1; dy <= 1; dy++)
+    {
+        for (int dx = -1; dx <= 1; dx++)
+        {
+            if (dx == 0 && dy == 0) continue;
+            if (!isWalkable(x + dx, y + dy)) continue;
+            if (dx != 0 && dy != 0 && !(isWalkable(x + dx, y) && isWalkable(x, y + dy))) continue;
+
+            push(x + dx + (y + dy) * grid->width, index, costs[index] + (dx != 0 && dy != 0 ? diagonalCost : 1.0f));
+        }
+    }
+}
+
+void PathSearch::jumpPointSearch(const int index)
+{
+    const int x = index % grid->width;
+    const int y = index / grid->width;
+
+    auto tryJump = [&](const int dx, const int dy)
+    {
+        const int jumpPoint = jump(x + dx, y + dy, dx, dy);
+        if (jumpPoint < 0) return;
+
+        const int distanceX = std::abs(jumpPoint % grid->width - x);
+        const int distanceY = std::abs(jumpPoint / grid->width - y);
+        const float distance = static_cast<float>(std::max(distanceX, distanceY)) + (diagonalCost - 1.0f) * static_cast<float>(std::min(distanceX, distanceY));
+        push(jumpPoint, index, costs[index] + distance);
+    };
+
+    const int parent = parents[index];
+
+    if (parent < 0)
+    {
+        for (int dy = -1; dy <= 1; dy++)
+        {
+            for (int dx = -1; dx <= 1; dx++)
+            {
+                if (dx == 0 && dy == 0) continue;
+                if (dx != 0 && dy != 0 && !(isWalkable(x + dx, y) && isWalkable(x, y + dy))) continue;
+
+                tryJump(dx, dy);
+            }
+        }
+
+        return;
+    }
+
+    const int dx = std::clamp(x - parent % grid->width, -1, 1);
+    const int dy = std::clamp(y - parent / grid->width, -1, 1);
+
+    if (dx != 0 && dy != 0)
+    {
+        const bool vertical = isWalkable(x, y + dy);
+        const bool horizontal = isWalkable(x + dx, y);
+
+        if (vertical) tryJump(0, dy);
+        if (horizontal) tryJump(dx, 0);
+        if (vertical && horizontal) tryJump(dx, dy);
+    }
+    else if (dx != 0)
+    {
+        const bool next = isWalkable(x + dx, y);
+        const bool below = isWalkable(x, y + 1);
+        const bool above = isWalkable(x, y - 1);
+
+        if (next)
+        {
+            tryJump(dx, 0);
+            if (below) tryJump(dx, 1);
+            if (above) tryJump(dx, -1);
+        }
+
+        if (below) tryJump(0, 1);
+        if (above) tryJump(0, -1);
+    }
+    else
+    {
+        const bool next = isWalkable(x, y + dy);
+        const bool right = isWalkable(x + 1, y);
+        const bool left = isWalkable(x - 1, y);
+
+        if (next)
+        {
+            tryJump(0, dy);
+            if (right) tryJump(1, dy);
+            if (left) tryJump(-1, dy);
+        }
+
+        if (right) tryJump(1, 0);
+        if (left) tryJump(-1, 0);
+    }
+}
+
+int PathSearch::jump(int x, int y, const int dx, const int dy) const
+{
+    while (isWalkable(x, y))
+    {
+        if (x == goal.x && y == goal.y) return x + y * grid->width;
+
+        if (dx != 0 && dy != 0)
+        {
+            if (jump(x + dx, y, dx, 0) >= 0 || jump(x, y + dy, 0, dy) >= 0) return x + y * grid->width;
+            if (!(isWalkable(x + dx, y) && isWalkable(x, y + dy))) return -1;
+        }
+        else if (dx != 0)
+        {
+            if ((isWalkable(x, y - 1) && !isWalkable(x - dx, y - 1)) || (isWalkable(x, y + 1) && !isWalkable(x - dx, y + 1))) return x + y * grid->width;
+        }
+        else
+        {
+            if ((isWalkable(x - 1, y) && !isWalkable(x - 1, y - dy)) || (isWalkable(x + 1, y) && !isWalkable(x + 1, y - dy))) return x + y * grid->width;
+        }
+
+        x += dx;
+        y += dy;
+    }
+
+    return -1;
+}
+
+Pathfinder::~Pathfinder()
+{
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+
+    workAvailable.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+Pathfinder::CacheKey Pathfinder::getCacheKey(const PathQuery& query)
+{
+    return {query.from.x, query.from.y, query.to.x, query.to.y, query.blockingFlags, query.algorithm};
+}
+
+void Pathfinder::setGrid(const int width, const int height, std::vector<uint32_t> cellFlags)
+{
+    grid = std::make_shared<PathGrid>(width, height, std::move(cellFlags));
+    gridVersion++;
+    cache.clear();
+}
+
+void Pathfinder::setCell(const int x, const int y, const uint32_t flags)
+{
+    if (grid->cellFlags[x + y * grid->width] == flags) return;
+
+    if (grid == batchGrid)
+    {
+        grid = std::make_shared<PathGrid>(*grid);
+    }
+
+    grid->cellFlags[x + y * grid->width] = flags;
+    gridVersion++;
+    cache.clear();
+}
+
+std::vector<Vector2i> Pathfinder::findPath(const PathQuery& query)
+{
+    const CacheKey key = getCacheKey(query);
+    if (const auto cached = cache.find(key); cached != cache.end()) return cached->second;
+
+    std::vector<Vector2i> path;
+    search.findPath(*grid, query, path);
+
+    if (cache.size() >= maxCacheSize) cache.clear();
+    cache.emplace(key, path);
+    return path;
+}
+
+void Pathfinder::requestPath(Entity* entity, const PathQuery& query)
+{
+    if (const auto cached = cache.find(getCacheKey(query)); cached != cache.end())
+    {
+        ready.push_back({entity, query, gridVersion, false, cached->second});
+        return;
+    }
+
+    pending.push_back({entity, query, gridVersion, false, {}});
+}
+
+void Pathfinder::cancel(const Entity* entity)
+{
+    for (std::vector<PathJob>* jobs : {&pending, &ready, &delivering, &batch})
+    {
+        for (PathJob& job : *jobs)
+        {
+            if (job.entity == entity) job.canceled = true;
+        }
+    }
+}
+
+void Pathfinder::dispatch()
+{
+    if (pending.empty()) return;
+
+    for (PathJob& job : pending)
+    {
+        job.gridVersion = gridVersion;
+    }
+
+#ifdef __EMSCRIPTEN__
+    for (PathJob& job : pending)
+    {
+        search.findPath(*grid, job.query, job.path);
+    }
+
+    std::swap(batch, pending);
+#else
+    if (workers.empty())
+    {
+        const unsigned int workerCount = std::clamp(std::thread::hardware_concurrency(), 2u, 5u) - 1;
+
+        for (unsigned int i = 0; i < workerCount; i++)
+        {
+            workers.emplace_back(&Pathfinder::work, this);
+        }
+    }
+
+    {
+        std::lock_guard lock(mutex);
+        std::swap(batch, pending);
+        batchGrid = grid;
+        nextJob = 0;
+        remainingJobs = batch.size();
+        batchGeneration++;
+    }
+
+    workAvailable.notify_all();
+#endif
+}
+
+void Pathfinder::work()
+{
+    PathSearch workerSearch;
+    uint32_t generation = 0;
+
+    while (true)
+    {
+        std::unique_lock lock(mutex);
+        workAvailable.wait(lock, [&] { return stopping || generation != batchGeneration; });
+        if (stopping) return;
+
+        generation = batchGeneration;
+        if (remainingJobs == 0) continue;
+
+        activeWorkers++;
+        PathJob* const jobs = batch.data();
+        const size_t jobCount = batch.size();
+        const std::shared_ptr<const PathGrid> jobGrid = batchGrid;
+        lock.unlock();
+
+        size_t done = 0;
+
+        for (size_t i = nextJob++; i < jobCount; i = nextJob++)
+        {
+            workerSearch.findPath(*jobGrid, jobs[i].query, jobs[i].path);
+            done++;
+        }
+
+        lock.lock();
+        remainingJobs -= done;
+        activeWorkers--;
+        if (remainingJobs == 0 && activeWorkers == 0) workDone.notify_all();
+    }
+}
+
+void Pathfinder::deliver()
+{
+    {
+        std::unique_lock lock(mutex);
+
+        if (!batch.empty())
+        {
+            workDone.wait(lock, [&] { return remainingJobs == 0 && activeWorkers == 0; });
+            batchGrid.reset();
+        }
+
+        for (PathJob& job : batch)
+        {
+            if (job.canceled) continue;
+
+            if (job.gridVersion != gridVersion)
+            {
+                pending.push_back(std::move(job));
+                continue;
+            }
+
+            if (cache.size() >= maxCacheSize) cache.clear();
+            cache.emplace(getCacheKey(job.query), job.path);
+            ready.push_back(std::move(job));
+        }
+
+        batch.clear();
+    }
+    std::swap(delivering, ready);
+
+    for (const PathJob& job : delivering)
+    {
+        if (!job.canceled) job.entity->onPathResult(job.path);
+    }
+
+    delivering.clear();
+}
\ No newline at end of file
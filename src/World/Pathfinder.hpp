@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "Bee/Math/Vector2i.hpp"
+#include "Bee/World/Path.hpp"
+
+class Entity;
+
+struct PathGrid
+{
+    int width = 0;
+    int height = 0;
+    std::vector<uint32_t> cellFlags;
+};
+
+struct PathQuery
+{
+    Vector2i from;
+    Vector2i to;
+    uint32_t blockingFlags;
+    PathAlgorithm algorithm;
+};
+
+struct PathJob
+{
+    Entity* entity;
+    PathQuery query;
+    uint32_t gridVersion;
+    bool canceled = false;
+    std::vector<Vector2i> path;
+};
+
+class PathSearch
+{
+public:
+    void findPath(const PathGrid& grid, const PathQuery& query, std::vector<Vector2i>& path);
+
+private:
+    const PathGrid* grid = nullptr;
+    uint32_t blockingFlags = 0;
+    Vector2i goal;
+    uint32_t generation = 0;
+    std::vector<uint32_t> visited;
+    std::vector<uint32_t> closed;
+    std::vector<float> costs;
+    std::vector<int> parents;
+    std::vector<std::pair<float, int>> openList;
+
+    bool isWalkable(int x, int y) const;
+    void push(int index, int parent, float cost);
+    void aStar(int index);
+    void jumpPointSearch(int index);
+    int jump(int x, int y, int dx, int dy) const;
+    float heuristic(int index) const;
+};
+
+class Pathfinder
+{
+public:
+    ~Pathfinder();
+    void setGrid(int width, int height, std::vector<uint32_t> cellFlags);
+    void setCell(int x, int y, uint32_t flags);
+    std::vector<Vector2i> findPath(const PathQuery& query);
+    void requestPath(Entity* entity, const PathQuery& query);
+    void cancel(const Entity* entity);
+    void dispatch();
+    void deliver();
+
+private:
+    using CacheKey = std::tuple<int, int, int, int, uint32_t, PathAlgorithm>;
+
+    static constexpr size_t maxCacheSize = 1024;
+
+    std::shared_ptr<PathGrid> grid = std::make_shared<PathGrid>();
+    uint32_t gridVersion = 0;
+    std::map<CacheKey, std::vector<Vector2i>> cache;
+    std::vector<PathJob> pending;
+    std::vector<PathJob> ready;
+    std::vector<PathJob> delivering;
+    PathSearch search;
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable workDone;
+    std::vector<PathJob> batch;
+    std::shared_ptr<const PathGrid> batchGrid;
+    std::atomic<size_t> nextJob = 0;
+    size_t remainingJobs = 0;
+    int activeWorkers = 0;
+    uint32_t batchGeneration = 0;
+    bool stopping = false;
+
+    static CacheKey getCacheKey(const PathQuery& query);
+    void work();
+};
\ No newline at end of file
@@ -1,227 +1,1495 @@
 #include "Bee/World/World.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cfloat>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <tinyxml2.h>
 
 #include "Bee/Bee.hpp"
 #include "Bee/Log.hpp"
+#include "Bee/Math/Math.hpp"
 #include "Bee/Collision/Intersection.hpp"
 #include "Bee/Math/Vector3f.hpp"
+#include "Contacts.hpp"
+#include "EntitySlot.hpp"
+#include "EntityStorage.hpp"
+#include "JobSystem.hpp"
+#include "WorldCommand.hpp"
+#include "Pathfinder.hpp"
 #include "Tiles.hpp"
 #include "Collision/Collision.hpp"
 #include "Graphics/Renderer-Internal.hpp"
 
-World::World() = default;
+static constexpr uint64_t flowFieldLifetime = 60;
+static constexpr size_t parallelUpdateGrainSize = 16;
+static constexpr size_t entityQueueGrainSize = 256;
+static constexpr float maxFloorSlopeAngle = 89.0f;
+
+static void removeIndexedEntity(std::vector<Entity*>& indexedEntities, const Entity* entity)
+{
+    const auto it = std::ranges::find(indexedEntities, entity);
+    if (it == indexedEntities.end()) return;
+
+    *it = indexedEntities.back();
+    indexedEntities.pop_back();
+}
+
+enum class ContactEvent
+{
+    enter,
+    stay,
+    exit,
+};
+
+static bool checkWorldObjectCollision(const HitboxView& hitbox, const WorldObject* worldObject, Intersection& intersection)
+{
+    const size_t partCount = worldObject->getConvexPartCount();
+    if (partCount == 0) return Collision::checkCollision(hitbox, worldObject->getHitbox(), intersection);
+
+    HitboxView part;
+    Intersection partIntersection;
+    bool collision = false;
+
+    for (size_t i = 0; i < partCount; i++)
+    {
+        part.vertices = worldObject->getConvexPart(i);
+
+        if (Collision::checkCollision(hitbox, part, partIntersection) && (!collision || partIntersection.penetrationDepth > intersection.penetrationDepth))
+        {
+            intersection.penetrationDepth = partIntersection.penetrationDepth;
+            intersection.mtv = partIntersection.mtv;
+            collision = true;
+        }
+    }
+
+    return collision;
+}
+
+static bool castWorldObject(const HitboxView& hitbox, const Vector2f& displacement, const WorldObject* worldObject, float& time, Vector2f& normal)
+{
+    const size_t partCount = worldObject->getConvexPartCount();
+    if (partCount == 0) return Collision::castShape(hitbox, displacement, worldObject->getHitbox(), time, normal);
+
+    HitboxView part;
+    float partTime;
+    Vector2f partNormal;
+    bool hit = false;
+
+    for (size_t i = 0; i < partCount; i++)
+    {
+        part.vertices = worldObject->getConvexPart(i);
+
+        if (Collision::castShape(hitbox, displacement, part, partTime, partNormal) && (!hit || partTime < time))
+        {
+            time = partTime;
+            normal = partNormal;
+            hit = true;
+        }
+    }
+
+    return hit;
+}
+
+World::World()
+    : entityStorage(std::make_unique<EntityStorage>()), pathfinder(std::make_unique<Pathfinder>()) {}
 
 void World::update()
 {
-    for (Tile &tile : tiles)
+    pathfinder->deliver();
+
+    for (Tile &tile : tiles)
+    {
+        if (tile.animated && tile.animationFrames[tile.animationIndex].duration + tile.frameStartTime <= Bee::getTime())
+        {
+            tile.frameStartTime = Bee::getTime();
+            tile.animationIndex++;
+            if (tile.animationIndex >= tile.animationFrames.size())
+            {
+                tile.animationIndex = 0;
+            }
+            tile.position.x = tile.animationFrames[tile.animationIndex].tileId % tile.columns * tile.size.x;
+            tile.position.y = tile.animationFrames[tile.animationIndex].tileId / tile.columns * tile.size.y;
+        }
+    }
+
+    Vector2i renderPosition = Renderer::getCameraPosition() - Renderer::getViewPortSize() / 2.0f - Vector2i(1, 1);;
+    renderPosition.x = (renderPosition.x > 0) ? renderPosition.x : 0;
+    renderPosition.y = (renderPosition.y > 0) ? renderPosition.y : 0;
+
+    Vector2i renderSize = renderPosition + Renderer::getViewPortSize() + Vector2i(3, 3);
+    renderSize.x = renderSize.x < worldWidth ? renderSize.x : worldWidth;
+    renderSize.y = renderSize.y < worldHeight ? renderSize.y : worldHeight;
+
+    for (size_t i = 0; i < layers.size(); i++)
+    {
+        for (int x = renderPosition.x; x < renderSize.x; x++)
+        {
+            for (int y = renderPosition.y; y < renderSize.y; y++)
+            {
+                const int tileId = layers.at(i).tileIds[x + y * worldWidth];
+                if (tileId == 0) continue;
+
+                Vector3f pos;
+                pos.x = x;
+                pos.y = y;
+                pos.z = static_cast<float>(i) - nullLayer + 1;
+
+                Rect rect;
+                rect.x = tiles[tileId].position.x;
+                rect.y = tiles[tileId].position.y;
+                rect.w = tiles[tileId].size.x;
+                rect.h = tiles[tileId].size.y;
+
+                Renderer::queueTile(pos, tiles[tileId].textureID, rect);
+            }
+        }
+    }
+
+    deferringChanges = true;
+    scheduleEntities();
+    updateParallel();
+
+    for (Entity* entity : scheduledEntities)
+    {
+        if (!containsEntity(entity)) continue;
+
+        entity->update();
+    }
+
+    cullingStats.drawnHUDObjects = 0;
+    cullingStats.culledHUDObjects = 0;
+
+    for (HUDObject* hudObject : hudObjects)
+    {
+        hudObject->update();
+        hudObject->BaseObject::update();
+        queueHUDObject(hudObject);
+    }
+
+    entityStorage->animate(Bee::getDeltaTime() * 1000.0f);
+
+    for (const uint32_t index : entityStorage->finishedAnimations)
+    {
+        if (containsEntity(entities[index]))
+        {
+            entities[index]->onAnimationFinished(entityStorage->animations[index].id);
+        }
+    }
+
+    deferringChanges = false;
+    applyCommands();
+    queueEntities();
+
+    updateContacts();
+    pathfinder->dispatch();
+
+    frame++;
+    std::erase_if(flowFields, [&](const auto& flowField) { return flowField.second.lastUsedFrame + flowFieldLifetime < frame; });
+}
+
+EntityHandle World::addEntity(Entity* entity)
+{
+    if (containsEntity(entity))
+    {
+        Log::write("World", LogLevel::warning, "Entity is already present in the world");
+        return entity->handle;
+    }
+
+    uint32_t slotIndex = freeEntitySlot;
+
+    if (slotIndex != UINT32_MAX)
+    {
+        freeEntitySlot = entitySlots[slotIndex].index;
+    }
+    else
+    {
+        slotIndex = entitySlots.size();
+        entitySlots.emplace_back();
+    }
+
+    EntitySlot& slot = entitySlots[slotIndex];
+    slot.entity = entity;
+    slot.index = UINT32_MAX;
+    entity->handle = {slotIndex, slot.generation};
+    indexEntity(entity);
+
+    if (deferringChanges)
+    {
+        commands.push_back({WorldCommandType::addEntity, slotIndex, entity, nullptr});
+    }
+    else
+    {
+        insertEntity(slotIndex);
+    }
+
+    return entity->handle;
+}
+
+Entity* World::getEntity(const EntityHandle& handle) const
+{
+    if (handle.index >= entitySlots.size() || entitySlots[handle.index].generation != handle.generation) return nullptr;
+
+    return entitySlots[handle.index].entity;
+}
+
+Entity* World::getEntityByName(const std::string_view name) const
+{
+    const auto it = entityNames.find(name);
+    if (it == entityNames.end()) return nullptr;
+
+    return it->second.front();
+}
+
+std::span<Entity* const> World::getEntitiesByName(const std::string_view name) const
+{
+    const auto it = entityNames.find(name);
+    if (it == entityNames.end()) return {};
+
+    return it->second;
+}
+
+std::span<Entity* const> World::getEntitiesWithTag(const uint32_t tag) const
+{
+    if (!std::has_single_bit(tag))
+    {
+        Log::write("World", LogLevel::warning, "Entity tag %u is not a single bit", tag);
+        return {};
+    }
+
+    return entityTags[std::countr_zero(tag)];
+}
+
+std::span<Entity* const> World::getEntitiesByType(const std::type_index type) const
+{
+    const auto it = entityTypes.find(type);
+    if (it == entityTypes.end()) return {};
+
+    return it->second;
+}
+
+std::span<Entity* const> World::getAllEntities() const
+{
+    return entities;
+}
+
+Entity* World::removeEntity(Entity* entity)
+{
+    if (!containsEntity(entity)) return nullptr;
+
+    const uint32_t slotIndex = entity->handle.index;
+    detachEntity(entity);
+
+    if (deferringChanges)
+    {
+        commands.push_back({WorldCommandType::removeEntity, slotIndex, entity, nullptr});
+    }
+    else
+    {
+        releaseEntitySlot(slotIndex);
+    }
+
+    return entity;
+}
+
+void World::destroyEntity(Entity* entity)
+{
+    if (!containsEntity(entity)) return;
+
+    const uint32_t slotIndex = entity->handle.index;
+    detachEntity(entity);
+
+    if (deferringChanges)
+    {
+        commands.push_back({WorldCommandType::destroyEntity, slotIndex, entity, nullptr});
+    }
+    else
+    {
+        releaseEntitySlot(slotIndex);
+        deleteEntity(entity);
+    }
+}
+
+void World::deleteAllEntities()
+{
+    if (deferringChanges)
+    {
+        for (Entity* entity : entities)
+        {
+            destroyEntity(entity);
+        }
+
+        for (size_t i = 0, size = commands.size(); i < size; i++)
+        {
+            if (commands[i].type == WorldCommandType::addEntity) destroyEntity(commands[i].entity);
+        }
+
+        return;
+    }
+
+    if (dispatchingContacts)
+    {
+        removedContactEntities.insert(removedContactEntities.end(), entities.begin(), entities.end());
+    }
+    else
+    {
+        contacts.clear();
+    }
+
+    for (size_t i = entities.size(); i-- > 0;)
+    {
+        entityStorage->remove(entities[i], entities[i]);
+        entities[i]->handle = {};
+        entities[i]->world = nullptr;
+        pathfinder->cancel(entities[i]);
+        entitySlots[entitySlotIndices[i]].index = UINT32_MAX;
+        releaseEntitySlot(entitySlotIndices[i]);
+        deleteEntity(entities[i]);
+    }
+
+    entities.clear();
+    entitySlotIndices.clear();
+    entityStorage->clear();
+    entityNames.clear();
+    entityTypes.clear();
+
+    for (std::vector<Entity*>& taggedEntities : entityTags)
+    {
+        taggedEntities.clear();
+    }
+}
+
+void World::addHUDObject(HUDObject* hudObject)
+{
+    if (containsHUDObject(hudObject))
+    {
+        Log::write("World", LogLevel::warning, "HUD Object is already present in the world");
+    }
+    else if (deferringChanges)
+    {
+        commands.push_back({WorldCommandType::addHUDObject, 0, nullptr, hudObject});
+    }
+    else
+    {
+        hudObjects.push_back(hudObject);
+    }
+}
+
+std::span<HUDObject* const> World::getAllHUDObjects() const
+{
+    return hudObjects;
+}
+
+HUDObject* World::removeHUDObject(HUDObject* hudObject)
+{
+    if (!containsHUDObject(hudObject)) return nullptr;
+
+    if (deferringChanges)
+    {
+        commands.push_back({WorldCommandType::removeHUDObject, 0, nullptr, hudObject});
+    }
+    else
+    {
+        std::erase(hudObjects, hudObject);
+    }
+
+    return hudObject;
+}
+
+void World::destroyHUDObject(HUDObject* hudObject)
+{
+    if (!containsHUDObject(hudObject)) return;
+
+    if (deferringChanges)
+    {
+        commands.push_back({WorldCommandType::destroyHUDObject, 0, nullptr, hudObject});
+    }
+    else
+    {
+        std::erase(hudObjects, hudObject);
+        delete hudObject;
+    }
+}
+
+void World::deleteAllHUDObjects()
+{
+    if (deferringChanges)
+    {
+        for (HUDObject* hudObject : hudObjects)
+        {
+            destroyHUDObject(hudObject);
+        }
+
+        for (size_t i = 0, size = commands.size(); i < size; i++)
+        {
+            if (commands[i].type == WorldCommandType::addHUDObject) destroyHUDObject(commands[i].hudObject);
+        }
+
+        return;
+    }
+
+    for (const HUDObject* hudObject : hudObjects)
+    {
+        delete hudObject;
+    }
+
+    hudObjects.clear();
+}
+
+std::vector<Vector2i> World::findPath(const Vector2i& from, const Vector2i& to, const uint32_t blockingFlags, const PathAlgorithm algorithm)
+{
+    return pathfinder->findPath({from, to, blockingFlags, algorithm});
+}
+
+void World::requestPath(Entity* entity, const Vector2i& from, const Vector2i& to, const uint32_t blockingFlags, const PathAlgorithm algorithm)
+{
+    pathfinder->requestPath(entity, {from, to, blockingFlags, algorithm});
+}
+
+const FlowField& World::getFlowField(const Vector2i& goal, const uint32_t blockingFlags)
+{
+    auto [flowField, inserted] = flowFields.try_emplace({goal.x, goal.y, blockingFlags});
+
+    if (inserted)
+    {
+        flowField->second.build(cellFlags, worldWidth, worldHeight, goal, blockingFlags);
+    }
+
+    flowField->second.lastUsedFrame = frame;
+    return flowField->second;
+}
+
+std::span<WorldObject* const> World::getAllWorldObjects() const
+{
+    return worldObjects;
+}
+
+const Properties& World::getTileProperties(const Vector2f& position) const
+{
+    return tiles[getTopmostTileId(position)].properties;
+}
+
+uint32_t World::getTileFlags(const Vector2f& position) const
+{
+    const int x = static_cast<int>(std::floor(position.x));
+    const int y = static_cast<int>(std::floor(position.y));
+
+    if (x < 0 || y < 0 || x >= worldWidth || y >= worldHeight) return TileFlags::none;
+
+    return cellFlags[x + y * worldWidth];
+}
+
+void World::setTile(const std::string& layerName, const Vector2i& position, const int tileId)
+{
+    if (position.x < 0 || position.y < 0 || position.x >= worldWidth || position.y >= worldHeight) return;
+
+    if (tileId < 0 || static_cast<size_t>(tileId) >= tileFlags.size())
+    {
+        Log::write("World", LogLevel::warning, "Invalid tile id: %d", tileId);
+        return;
+    }
+
+    const auto layer = std::ranges::find(layers, layerName, &TileLayer::name);
+
+    if (layer == layers.end())
+    {
+        Log::write("World", LogLevel::warning, "Can't find tile layer: %s", layerName.c_str());
+        return;
+    }
+
+    const uint32_t previousFlags = cellFlags[position.x + position.y * worldWidth];
+    layer->tileIds[position.x + position.y * worldWidth] = tileId;
+    updateTopmostTileId(position.x, position.y);
+
+    const uint32_t flags = cellFlags[position.x + position.y * worldWidth];
+    if (flags == previousFlags) return;
+
+    pathfinder->setCell(position.x, position.y, flags);
+
+    for (auto& [key, flowField] : flowFields)
+    {
+        if ((flags & flowField.blockingFlags) != (previousFlags & flowField.blockingFlags))
+        {
+            flowField.updateCell(cellFlags, position.x, position.y);
+        }
+    }
+}
+
+std::vector<Intersection> World::getIntersections(const Entity* entity) const
+{
+    std::vector<Intersection> intersections;
+    const HitboxView hitbox = entity->getHitBox();
+    const AABB& aabb = entity->getAABB();
+    const CollisionFilter& filter = entity->getCollisionFilter();
+
+    for (Entity* entityLoop : entities)
+    {
+        if (entity == entityLoop) continue;
+        if (!filter.shouldCollide(entityLoop->getCollisionFilter())) continue;
+        if (!aabb.overlaps(entityLoop->getAABB())) continue;
+
+        Intersection intersection;
+        intersection.entity = entityLoop;
+        intersection.worldObject = nullptr;
+        if (Collision::checkCollision(hitbox, entityLoop->getHitBox(), intersection))
+        {
+            intersections.push_back(intersection);
+        }
+    }
+
+    for (WorldObject* worldObject : worldObjects)
+    {
+        if (!filter.shouldCollide(worldObject->getCollisionFilter())) continue;
+        if (!aabb.overlaps(worldObject->getAABB())) continue;
+
+        Intersection intersection;
+        intersection.entity = nullptr;
+        intersection.worldObject = worldObject;
+        if (checkWorldObjectCollision(hitbox, worldObject, intersection))
+        {
+            intersections.push_back(intersection);
+        }
+    }
+
+    return intersections;
+}
+
+CastResult World::castShape(const Hitbox& hitbox, const Vector2f& displacement, const Entity* ignore, const CollisionFilter& filter) const
+{
+    CastResult result;
+    const HitboxView hitboxView = hitbox;
+    const AABB start = Collision::getBounds(hitboxView);
+    AABB sweep = start;
+
+    sweep.min.x += std::min(displacement.x, 0.0f);
+    sweep.min.y += std::min(displacement.y, 0.0f);
+    sweep.max.x += std::max(displacement.x, 0.0f);
+    sweep.max.y += std::max(displacement.y, 0.0f);
+
+    float time;
+    Vector2f normal;
+
+    for (Entity* entity : entities)
+    {
+        if (entity == ignore) continue;
+        if (!filter.shouldCollide(entity->getCollisionFilter())) continue;
+        if (!sweep.overlaps(entity->getAABB())) continue;
+
+        if (Collision::castShape(hitboxView, displacement, entity->getHitBox(), time, normal) && time < result.time)
+        {
+            result = {true, time, normal, entity, nullptr};
+        }
+    }
+
+    for (WorldObject* worldObject : worldObjects)
+    {
+        if (!filter.shouldCollide(worldObject->getCollisionFilter())) continue;
+        if (!sweep.overlaps(worldObject->getAABB())) continue;
+
+        if (castWorldObject(hitboxView, displacement, worldObject, time, normal) && time < result.time)
+        {
+            result = {true, time, normal, nullptr, worldObject};
+        }
+    }
+
+    return result;
+}
+
+static bool checkCandidateCollision(const HitboxView& hitbox, const CastResult& candidate, Intersection& intersection)
+{
+    if (candidate.entity) return Collision::checkCollision(hitbox, candidate.entity->getHitBox(), intersection);
+    return checkWorldObjectCollision(hitbox, candidate.worldObject, intersection);
+}
+
+static bool castCandidate(const HitboxView& hitbox, const Vector2f& displacement, const CastResult& candidate, float& time, Vector2f& normal)
+{
+    if (candidate.entity) return Collision::castShape(hitbox, displacement, candidate.entity->getHitBox(), time, normal);
+    return castWorldObject(hitbox, displacement, candidate.worldObject, time, normal);
+}
+
+static Vector2f slide(const Vector2f& displacement, const Vector2f& normal, const Vector2f& up, const float minFloorDot)
+{
+    const float upDot = normal.dot(up);
+
+    if (upDot >= minFloorDot)
+    {
+        const Vector2f horizontal(-up.y, up.x);
+        const Vector2f tangent(-normal.y, normal.x);
+        return tangent * (displacement.dot(horizontal) / tangent.dot(horizontal));
+    }
+
+    const Vector2f slid = displacement - normal * displacement.dot(normal);
+
+    if (upDot > 0.0f && slid.dot(up) > 0.0f)
+    {
+        Vector2f wallNormal = normal - up * upDot;
+        wallNormal.normalize();
+        return displacement - wallNormal * displacement.dot(wallNormal);
+    }
+
+    return slid;
+}
+
+static void classifyContact(MoveResult& result, const Vector2f& normal, const Vector2f& up, const float minFloorDot)
+{
+    const float upDot = normal.dot(up);
+
+    if (upDot >= minFloorDot)
+    {
+        result.onFloor = true;
+        result.floorNormal = normal;
+    }
+    else if (upDot <= -minFloorDot)
+    {
+        result.onCeiling = true;
+    }
+    else
+    {
+        result.onWall = true;
+    }
+}
+
+MoveResult World::moveAndSlide(Entity* entity, const Vector2f& displacement, const Vector2f& up, const float maxSlopeAngle)
+{
+    static constexpr int maxIterations = 4;
+    static constexpr float contactProbe = 0.01f;
+    static constexpr float minDisplacement = 0.0001f;
+
+    MoveResult result;
+    const Vector3f start = entity->getPosition();
+    const float minFloorDot = cosf(Math::radians(std::clamp(maxSlopeAngle, 0.0f, maxFloorSlopeAngle)));
+    const CollisionFilter& filter = entity->getCollisionFilter();
+
+    AABB sweep = entity->getAABB();
+    sweep.min.x += std::min(displacement.x, 0.0f) - contactProbe;
+    sweep.min.y += std::min(displacement.y, 0.0f) - contactProbe;
+    sweep.max.x += std::max(displacement.x, 0.0f) + contactProbe;
+    sweep.max.y += std::max(displacement.y, 0.0f) + contactProbe;
+
+    slideCandidates.clear();
+
+    for (Entity* entityLoop : entities)
+    {
+        if (entityLoop == entity) continue;
+        if (!filter.shouldCollide(entityLoop->getCollisionFilter())) continue;
+        if (!sweep.overlaps(entityLoop->getAABB())) continue;
+
+        slideCandidates.push_back({false, 1.0f, {0, 0}, entityLoop, nullptr});
+    }
+
+    for (WorldObject* worldObject : worldObjects)
+    {
+        if (!filter.shouldCollide(worldObject->getCollisionFilter())) continue;
+        if (!sweep.overlaps(worldObject->getAABB())) continue;
+
+        slideCandidates.push_back({false, 1.0f, {0, 0}, nullptr, worldObject});
+    }
+
+    Intersection intersection;
+
+    for (int i = 0; i < maxIterations; i++)
+    {
+        bool penetrating = false;
+
+        for (const CastResult& candidate : slideCandidates)
+        {
+            if (checkCandidateCollision(entity->getHitBox(), candidate, intersection) && intersection.penetrationDepth > 0.0f)
+            {
+                entity->moveOffset(intersection.mtv);
+                penetrating = true;
+            }
+        }
+
+        if (!penetrating) break;
+    }
+
+    Vector2f remaining = displacement;
+    float time;
+    Vector2f normal;
+    Vector2f lastNormal;
+
+    for (const CastResult& contact : entity->slideContacts)
+    {
+        if (remaining.dot(contact.normal) >= 0.0f) continue;
+
+        const auto candidate = std::ranges::find_if(slideCandidates, [&](const CastResult& slideCandidate)
+        {
+            return slideCandidate.entity == contact.entity && slideCandidate.worldObject == contact.worldObject;
+        });
+
+        if (candidate == slideCandidates.end() || candidate->hit) continue;
+        if (!castCandidate(entity->getHitBox(), contact.normal * -contactProbe, *candidate, time, normal)) continue;
+
+        candidate->hit = true;
+        candidate->time = 0.0f;
+        candidate->normal = normal;
+        remaining = slide(remaining, normal, up, minFloorDot);
+        lastNormal = normal;
+        classifyContact(result, normal, up, minFloorDot);
+    }
+
+    entity->slideContacts.clear();
+
+    for (const CastResult& candidate : slideCandidates)
+    {
+        if (candidate.hit) entity->slideContacts.push_back(candidate);
+    }
+
+    for (int i = 0; i < maxIterations && remaining.getLength() > minDisplacement; i++)
+    {
+        CastResult hit;
+
+        for (const CastResult& candidate : slideCandidates)
+        {
+            if (castCandidate(entity->getHitBox(), remaining, candidate, time, normal) && time < hit.time)
+            {
+                hit = {true, time, normal, candidate.entity, candidate.worldObject};
+            }
+        }
+
+        entity->moveOffset(remaining * hit.time);
+        if (!hit.hit) break;
+
+        entity->slideContacts.push_back(hit);
+        classifyContact(result, hit.normal, up, minFloorDot);
+
+        remaining = slide(remaining * (1.0f - hit.time), hit.normal, up, minFloorDot);
+        if (remaining.dot(lastNormal) < 0.0f) remaining = {0, 0};
+        lastNormal = hit.normal;
+    }
+
+    const Vector3f end = entity->getPosition();
+    result.displacement = {end.x - start.x, end.y - start.y};
+    return result;
+}
+
+CastResult World::raycast(const Ray& ray, bool (*isBlocking)(const Properties& properties)) const
+{
+    CastResult result;
+
+    if (isBlocking)
+    {
+        raycastTiles(ray, [&](const int tileId) { return isBlocking(tiles[tileId].properties); }, result);
+    }
+
+    raycastObjects(ray, result);
+    return result;
+}
+
+void World::raycast(std::span<const Ray> rays, std::span<CastResult> results, bool (*isBlocking)(const Properties& properties)) const
+{
+    std::vector<int8_t> blockingTiles;
+
+    if (isBlocking)
+    {
+        blockingTiles.resize(tiles.size(), -1);
+    }
+
+    auto isBlockingTile = [&](const int tileId)
+    {
+        if (blockingTiles[tileId] < 0)
+        {
+            blockingTiles[tileId] = isBlocking(tiles[tileId].properties);
+        }
+        return blockingTiles[tileId] == 1;
+    };
+
+    for (size_t i = 0; i < rays.size(); i++)
+    {
+        results[i] = {};
+
+        if (isBlocking)
+        {
+            raycastTiles(rays[i], isBlockingTile, results[i]);
+        }
+
+        raycastObjects(rays[i], results[i]);
+    }
+}
+
+CastResult World::raycast(const Ray& ray, const uint32_t blockingFlags) const
+{
+    CastResult result;
+
+    if (blockingFlags)
+    {
+        raycastTiles(ray, [&](const int tileId) { return (tileFlags[tileId] & blockingFlags) != 0; }, result);
+    }
+
+    raycastObjects(ray, result);
+    return result;
+}
+
+bool World::hasLineOfSight(const Vector2f& from, const Vector2f& to, bool (*isBlocking)(const Properties& properties)) const
+{
+    Ray ray;
+    ray.origin = from;
+    ray.displacement = to - from;
+    ray.ignoreEntities = true;
+
+    return !raycast(ray, isBlocking).hit;
+}
+
+bool World::hasLineOfSight(const Vector2f& from, const Vector2f& to, const uint32_t blockingFlags) const
+{
+    Ray ray;
+    ray.origin = from;
+    ray.displacement = to - from;
+    ray.ignoreEntities = true;
+
+    return !raycast(ray, blockingFlags).hit;
+}
+
+int World::getTopmostTileId(const int x, const int y) const
+{
+    return topmostTileIds[x + y * worldWidth];
+}
+
+int World::getTopmostTileId(const Vector2f& position) const
+{
+    const int x = static_cast<int>(std::floor(position.x));
+    const int y = static_cast<int>(std::floor(position.y));
+
+    if (x < 0 || y < 0 || x >= worldWidth || y >= worldHeight) return 0;
+
+    return topmostTileIds[x + y * worldWidth];
+}
+
+void World::updateTopmostTileId(const int x, const int y)
+{
+    int& topmostTileId = topmostTileIds[x + y * worldWidth];
+    topmostTileId = 0;
+
+    for (auto layer = layers.rbegin(); layer != layers.rend(); ++layer)
+    {
+        if (const int tileId = layer->tileIds[x + y * worldWidth]; tileId != 0)
+        {
+            topmostTileId = tileId;
+            break;
+        }
+    }
+
+    cellFlags[x + y * worldWidth] = tileFlags[topmostTileId];
+}
+
+template<typename BlockingFunc>
+void World::raycastTiles(const Ray& ray, BlockingFunc isBlockingTile, CastResult& result) const
+{
+    const Vector2f& origin = ray.origin;
+    const Vector2f& displacement = ray.displacement;
+
+    Vector2i cell(static_cast<int>(floorf(origin.x)), static_cast<int>(floorf(origin.y)));
+    const Vector2i end(static_cast<int>(floorf(origin.x + displacement.x)), static_cast<int>(floorf(origin.y + displacement.y)));
+    const Vector2i step(displacement.x > 0 ? 1 : -1, displacement.y > 0 ? 1 : -1);
+    const Vector2f timeDelta(displacement.x != 0 ? fabsf(1.0f / displacement.x) : FLT_MAX, displacement.y != 0 ? fabsf(1.0f / displacement.y) : FLT_MAX);
+
+    Vector2f timeMax;
+    timeMax.x = displacement.x != 0 ? (displacement.x > 0 ? cell.x + 1 - origin.x : origin.x - cell.x) * timeDelta.x : FLT_MAX;
+    timeMax.y = displacement.y != 0 ? (displacement.y > 0 ? cell.y + 1 - origin.y : origin.y - cell.y) * timeDelta.y : FLT_MAX;
+
+    float time = 0.0f;
+    Vector2f normal(0, 0);
+    int steps = abs(end.x - cell.x) + abs(end.y - cell.y);
+
+    while (true)
+    {
+        if (cell.x >= 0 && cell.y >= 0 && cell.x < worldWidth && cell.y < worldHeight && isBlockingTile(getTopmostTileId(cell.x, cell.y)))
+        {
+            result.hit = true;
+            result.time = time;
+            result.normal = normal;
+            result.tile = cell;
+            return;
+        }
+
+        if (steps-- <= 0) return;
+
+        if (timeMax.x < timeMax.y)
+        {
+            time = timeMax.x;
+            timeMax.x += timeDelta.x;
+            cell.x += step.x;
+            normal = {static_cast<float>(-step.x), 0.0f};
+        }
+        else
+        {
+            time = timeMax.y;
+            timeMax.y += timeDelta.y;
+            cell.y += step.y;
+            normal = {0.0f, static_cast<float>(-step.y)};
+        }
+
+        if (time > result.time) return;
+    }
+}
+
+void World::raycastObjects(const Ray& ray, CastResult& result) const
+{
+    HitboxView point;
+    point.shape = HitboxShape::point;
+    point.center = ray.origin;
+
+    AABB sweep;
+    sweep.min = {std::min(ray.origin.x, ray.origin.x + ray.displacement.x), std::min(ray.origin.y, ray.origin.y + ray.displacement.y)};
+    sweep.max = {std::max(ray.origin.x, ray.origin.x + ray.displacement.x), std::max(ray.origin.y, ray.origin.y + ray.displacement.y)};
+
+    float time;
+    Vector2f normal;
+
+    if (!ray.ignoreEntities)
     {
-        if (tile.animated && tile.animationFrames[tile.animationIndex].duration + tile.frameStartTime <= Bee::getTime())
+        for (Entity* entity : entities)
         {
-            tile.frameStartTime = Bee::getTime();
-            tile.animationIndex++;
-            if (tile.animationIndex >= tile.animationFrames.size())
+            if (entity == ray.ignore) continue;
+            if (!ray.filter.shouldCollide(entity->getCollisionFilter())) continue;
+            if (!sweep.overlaps(entity->getAABB())) continue;
+
+            if (Collision::castShape(point, ray.displacement, entity->getHitBox(), time, normal) && time < result.time)
             {
-                tile.animationIndex = 0;
+                result = {true, time, normal, entity, nullptr};
             }
-            tile.position.x = tile.animationFrames[tile.animationIndex].tileId % tile.columns * tile.size.x;
-            tile.position.y = tile.animationFrames[tile.animationIndex].tileId / tile.columns * tile.size.y;
         }
     }
 
-    Vector2i renderPosition = Renderer::getCameraPosition() - Renderer::getViewPortSize() / 2.0f - Vector2i(1, 1);;
-    renderPosition.x = (renderPosition.x > 0) ? renderPosition.x : 0;
-    renderPosition.y = (renderPosition.y > 0) ? renderPosition.y : 0;
+    for (WorldObject* worldObject : worldObjects)
+    {
+        if (!ray.filter.shouldCollide(worldObject->getCollisionFilter())) continue;
+        if (!sweep.overlaps(worldObject->getAABB())) continue;
 
-    Vector2i renderSize = renderPosition + Renderer::getViewPortSize() + Vector2i(3, 3);
-    renderSize.x = renderSize.x < worldWidth ? renderSize.x : worldWidth;
-    renderSize.y = renderSize.y < worldHeight ? renderSize.y : worldHeight;
+        if (castWorldObject(point, ray.displacement, worldObject, time, normal) && time < result.time)
+        {
+            result = {true, time, normal, nullptr, worldObject};
+        }
+    }
+}
 
-    for (size_t i = 0; i < layers.size(); i++)
+static uint64_t getContactKey(const EntityHandle& handle)
+{
+    return static_cast<uint64_t>(handle.index) << 32 | handle.generation;
+}
+
+static bool contactLess(const Contact& contact1, const Contact& contact2)
+{
+    return std::tuple(contact1.entityKey, contact1.worldObject != nullptr, contact1.otherKey)
+        < std::tuple(contact2.entityKey, contact2.worldObject != nullptr, contact2.otherKey);
+}
+
+static void dispatchContact(Entity* entity, const Intersection& intersection, const bool trigger, const ContactEvent event)
+{
+    if (event == ContactEvent::enter) entity->wake();
+    if (!entity->hasCollisionEvents()) return;
+
+    switch (event)
     {
-        for (int x = renderPosition.x; x < renderSize.x; x++)
+        case ContactEvent::enter:
+            trigger ? entity->onTriggerEnter(intersection) : entity->onCollisionEnter(intersection);
+            break;
+        case ContactEvent::stay:
+            trigger ? entity->onTriggerStay(intersection) : entity->onCollisionStay(intersection);
+            break;
+        case ContactEvent::exit:
+            trigger ? entity->onTriggerExit(intersection) : entity->onCollisionExit(intersection);
+            break;
+    }
+}
+
+void World::updateContacts()
+{
+    contactProxies.clear();
+
+    for (Entity* entity : entities)
+    {
+        contactProxies.push_back({entity->getAABB(), entity, nullptr, getContactKey(entity->handle)});
+    }
+
+    for (size_t i = 0; i < worldObjects.size(); i++)
+    {
+        contactProxies.push_back({worldObjects[i]->getAABB(), nullptr, worldObjects[i], i});
+    }
+
+    std::ranges::sort(contactProxies, {}, [](const ContactProxy& proxy) { return proxy.aabb.min.x; });
+
+    std::swap(contacts, previousContacts);
+    contacts.clear();
+
+    for (size_t i = 0; i < contactProxies.size(); i++)
+    {
+        const ContactProxy& proxy = contactProxies[i];
+
+        for (size_t j = i + 1; j < contactProxies.size() && contactProxies[j].aabb.min.x <= proxy.aabb.max.x; j++)
         {
-            for (int y = renderPosition.y; y < renderSize.y; y++)
+            const ContactProxy& otherProxy = contactProxies[j];
+
+            if (!proxy.entity && !otherProxy.entity) continue;
+            if (!proxy.aabb.overlaps(otherProxy.aabb)) continue;
+
+            Contact contact = {proxy.entity, otherProxy.entity, otherProxy.worldObject, {}, proxy.key, otherProxy.key};
+
+            if (!contact.entity)
             {
-                const int tileId = layers.at(i).tileIds[x + y * worldWidth];
-                if (tileId == 0) continue;
+                contact.entity = otherProxy.entity;
+                contact.otherEntity = nullptr;
+                contact.worldObject = proxy.worldObject;
+                std::swap(contact.entityKey, contact.otherKey);
+            }
+            else if (contact.otherEntity && contact.otherKey < contact.entityKey)
+            {
+                std::swap(contact.entity, contact.otherEntity);
+                std::swap(contact.entityKey, contact.otherKey);
+            }
 
-                Vector3f pos;
-                pos.x = x;
-                pos.y = y;
-                pos.z = static_cast<float>(i) - nullLayer + 1;
+            const bool entityListens = contact.entity->hasCollisionEvents() || contact.entity->isSleeping();
+            const bool otherEntityListens = contact.otherEntity && (contact.otherEntity->hasCollisionEvents() || contact.otherEntity->isSleeping());
+            if (!entityListens && !otherEntityListens) continue;
 
-                Rect rect;
-                rect.x = tiles[tileId].position.x;
-                rect.y = tiles[tileId].position.y;
-                rect.w = tiles[tileId].size.x;
-                rect.h = tiles[tileId].size.y;
+            const CollisionFilter& otherFilter = contact.otherEntity ? contact.otherEntity->getCollisionFilter() : contact.worldObject->getCollisionFilter();
+            if (!contact.entity->getCollisionFilter().shouldCollide(otherFilter)) continue;
 
-                Renderer::queueTile(pos, tiles[tileId].textureID, rect);
+            const HitboxView hitbox = contact.entity->getHitBox();
+            contact.intersection.entity = contact.otherEntity;
+            contact.intersection.worldObject = contact.worldObject;
+
+            if (contact.otherEntity ? Collision::checkCollision(hitbox, contact.otherEntity->getHitBox(), contact.intersection) : checkWorldObjectCollision(hitbox, contact.worldObject, contact.intersection))
+            {
+                contacts.push_back(contact);
             }
         }
     }
 
-    for (Entity* entity : entities)
+    std::ranges::sort(contacts, contactLess);
+    dispatchContacts();
+}
+
+void World::dispatchContacts()
+{
+    auto isRemoved = [&](const Entity* entity)
     {
-        entity->update();
-        entity->BaseObject::update();
-        entity->Entity::update();
+        return std::ranges::find(removedContactEntities, entity) != removedContactEntities.end();
+    };
+
+    auto dispatch = [&](const Contact& contact, const ContactEvent event)
+    {
+        const bool trigger = contact.worldObject && contact.worldObject->isTrigger();
+
+        if (!isRemoved(contact.entity))
+        {
+            dispatchContact(contact.entity, contact.intersection, trigger, event);
+        }
+
+        if (contact.otherEntity && !isRemoved(contact.otherEntity))
+        {
+            const Intersection intersection = {contact.entity, nullptr, contact.intersection.penetrationDepth, -contact.intersection.mtv};
+            dispatchContact(contact.otherEntity, intersection, trigger, event);
+        }
+    };
+
+    dispatchingContacts = true;
+
+    size_t previous = 0;
+    size_t current = 0;
+
+    while (previous < previousContacts.size() || current < contacts.size())
+    {
+        if (current == contacts.size() || (previous < previousContacts.size() && contactLess(previousContacts[previous], contacts[current])))
+        {
+            dispatch(previousContacts[previous++], ContactEvent::exit);
+        }
+        else if (previous == previousContacts.size() || contactLess(contacts[current], previousContacts[previous]))
+        {
+            dispatch(contacts[current++], ContactEvent::enter);
+        }
+        else
+        {
+            previous++;
+            dispatch(contacts[current++], ContactEvent::stay);
+        }
     }
 
-    for (HUDObject* hudObject : hudObjects)
+    dispatchingContacts = false;
+
+    for (const Entity* entity : removedContactEntities)
     {
-        hudObject->update();
-        hudObject->HUDObject::update();
+        removeContacts(entity);
     }
+
+    removedContactEntities.clear();
 }
 
-void World::addEntity(Entity* entity)
+void World::removeContacts(const Entity* entity)
 {
-    if (std::ranges::count(entities, entity))
+    if (dispatchingContacts)
     {
-        Log::write("World", LogLevel::warning, "Entity is already present in the world");
+        removedContactEntities.push_back(entity);
+        return;
+    }
+
+    std::erase_if(contacts, [&](const Contact& contact)
+    {
+        if (contact.entity != entity && contact.otherEntity != entity) return false;
+
+        if (contact.otherEntity && std::ranges::find(removedContactEntities, contact.entity == entity ? contact.otherEntity : contact.entity) == removedContactEntities.end())
+        {
+            Entity* other = contact.entity == entity ? contact.otherEntity : contact.entity;
+            const Intersection intersection = {const_cast<Entity*>(entity), nullptr, contact.intersection.penetrationDepth, contact.entity == entity ? -contact.intersection.mtv : contact.intersection.mtv};
+            dispatchContact(other, intersection, false, ContactEvent::exit);
+        }
+
+        return true;
+    });
+}
+
+bool World::containsEntity(const Entity* entity) const
+{
+    const EntityHandle& handle = entity->handle;
+
+    return handle.index < entitySlots.size() && entitySlots[handle.index].generation == handle.generation
+        && entitySlots[handle.index].entity == entity;
+}
+
+bool World::containsHUDObject(const HUDObject* hudObject) const
+{
+    bool contained = std::ranges::count(hudObjects, hudObject) > 0;
+
+    for (const WorldCommand& command : commands)
+    {
+        if (command.hudObject != hudObject) continue;
+
+        contained = command.type == WorldCommandType::addHUDObject;
+    }
+
+    return contained;
+}
+
+void World::deleteEntity(Entity* entity)
+{
+    if (entity->pool)
+    {
+        entity->pool->recycle(entity);
     }
     else
     {
-        entities.push_back(entity);
+        delete entity;
     }
 }
 
-Entity* World::getEntityByName(const std::string& name) const
+void World::insertEntity(const uint32_t slotIndex)
 {
-    // for (Entity* entity : entities)
-    // {
-    //     if (entity->getName() == name)
-    //         return entity;
-    // }
+    EntitySlot& slot = entitySlots[slotIndex];
+    if (!slot.entity) return;
 
-    return nullptr;
+    slot.index = entities.size();
+    entityStorage->add(slot.entity);
+    entities.push_back(slot.entity);
+    entitySlotIndices.push_back(slotIndex);
 }
 
-std::vector<Entity*> World::getAllEntities()
+void World::detachEntity(Entity* entity)
 {
-    return entities;
+    entitySlots[entity->handle.index].entity = nullptr;
+    entity->handle = {};
+    unindexEntity(entity);
+
+    removeContacts(entity);
+    pathfinder->cancel(entity);
 }
 
-Entity* World::removeEntity(Entity* entity)
+void World::releaseEntitySlot(const uint32_t slotIndex)
 {
-    if (std::ranges::count(entities, entity))
+    EntitySlot& slot = entitySlots[slotIndex];
+
+    if (slot.index != UINT32_MAX)
     {
-        std::erase(entities, entity);
-        return entity;
+        entityStorage->remove(entities[slot.index], entities.back());
+        entities[slot.index] = entities.back();
+        entitySlotIndices[slot.index] = entitySlotIndices.back();
+        entitySlots[entitySlotIndices[slot.index]].index = slot.index;
+        entities.pop_back();
+        entitySlotIndices.pop_back();
     }
 
-    return nullptr;
+    slot.entity = nullptr;
+    slot.generation++;
+    slot.index = freeEntitySlot;
+    freeEntitySlot = slotIndex;
 }
 
-void World::deleteAllEntities()
+void World::indexEntity(Entity* entity)
 {
-    for (const Entity* entity : entities)
+    entity->world = this;
+
+    if (!entity->name.empty())
     {
-        delete entity;
+        entityNames[entity->name].push_back(entity);
     }
 
-    entities.clear();
+    for (uint32_t tags = entity->tags; tags; tags &= tags - 1)
+    {
+        entityTags[std::countr_zero(tags)].push_back(entity);
+    }
+
+    entity->type = typeid(*entity);
+    entityTypes[entity->type].push_back(entity);
 }
 
-void World::addHUDObject(HUDObject* hudObject)
+void World::unindexEntity(Entity* entity)
 {
-    if (std::ranges::count(hudObjects, hudObject))
+    entity->world = nullptr;
+
+    unindexEntityName(entity);
+
+    for (uint32_t tags = entity->tags; tags; tags &= tags - 1)
     {
-        Log::write("World", LogLevel::warning, "HUD Object is already present in the world");
+        removeIndexedEntity(entityTags[std::countr_zero(tags)], entity);
     }
-    else
+
+    removeIndexedEntity(entityTypes[entity->type], entity);
+}
+
+void World::unindexEntityName(const Entity* entity)
+{
+    if (entity->name.empty()) return;
+
+    const auto it = entityNames.find(entity->name);
+    std::erase(it->second, entity);
+
+    if (it->second.empty())
     {
-        hudObjects.push_back(hudObject);
+        entityNames.erase(it);
     }
 }
 
-std::vector<HUDObject*> World::getAllHUDObjects()
+void World::setEntityName(Entity* entity, const std::string& name)
 {
-    return hudObjects;
+    if (entity->name == name) return;
+
+    unindexEntityName(entity);
+
+    entity->name = name;
+
+    if (!name.empty())
+    {
+        entityNames[name].push_back(entity);
+    }
 }
 
-HUDObject* World::removeHUDObject(HUDObject* hudObject)
+void World::setEntityTags(Entity* entity, const uint32_t tags)
 {
-    if (std::ranges::count(hudObjects, hudObject))
+    const uint32_t removedTags = entity->tags & ~tags;
+    const uint32_t addedTags = tags & ~entity->tags;
+    entity->tags = tags;
+
+    for (uint32_t bits = removedTags; bits; bits &= bits - 1)
     {
-        std::erase(hudObjects, hudObject);
-        return hudObject;
+        removeIndexedEntity(entityTags[std::countr_zero(bits)], entity);
     }
 
-    return nullptr;
+    for (uint32_t bits = addedTags; bits; bits &= bits - 1)
+    {
+        entityTags[std::countr_zero(bits)].push_back(entity);
+    }
 }
 
-void World::deleteAllHUDObjects()
+void World::scheduleEntities()
 {
-    for (const HUDObject* hudObject : hudObjects)
+    const float deltaTime = Bee::getDeltaTime();
+    const Vector2f cameraPosition = Renderer::getCameraPosition();
+    const Vector2f halfViewportSize = Renderer::getViewPortSize() / 2.0f;
+    const AABB viewport = {cameraPosition - halfViewportSize, cameraPosition + halfViewportSize};
+
+    scheduledEntities.clear();
+
+    for (size_t i = 0; i < entities.size(); i++)
     {
-        delete hudObject;
-    }
+        Entity* entity = entities[i];
+        entity->accumulatedTime += deltaTime;
 
-    hudObjects.clear();
+        if (entity->sleeping)
+        {
+            if (entity->wakeDistance <= 0.0f) continue;
+            if ((Vector2f(entityStorage->positions[i]) - cameraPosition).getLength() > entity->wakeDistance) continue;
+
+            entity->sleeping = false;
+        }
+
+        if (entity->updatePolicy != UpdatePolicy::always)
+        {
+            const AABB bounds = entityStorage->getBounds(i);
+            const float distance = std::max({
+                viewport.min.x - bounds.max.x,
+                bounds.min.x - viewport.max.x,
+                viewport.min.y - bounds.max.y,
+                bounds.min.y - viewport.max.y,
+            });
+
+            if (distance > 0.0f)
+            {
+                if (entity->updatePolicy == UpdatePolicy::onScreen) continue;
+
+                const uint32_t band = static_cast<uint32_t>(std::min(distance / updateBandSize, 30.0f));
+                const uint32_t interval = std::max(std::min(2u << band, maxUpdateInterval), 1u);
+
+                if ((frame + entity->handle.index) % interval != 0) continue;
+            }
+        }
+
+        entity->updateDeltaTime = entity->accumulatedTime;
+        entity->accumulatedTime = 0.0f;
+        scheduledEntities.push_back(entity);
+    }
 }
 
-std::vector<WorldObject*> World::getAllWorldObjects() const
+void World::setUpdateLevelOfDetail(const float bandSize, const uint32_t maxInterval)
 {
-    return worldObjects;
+    if (!(bandSize > 0.0f))
+    {
+        Log::write("World", LogLevel::warning, "Update band size %f must be positive", bandSize);
+        return;
+    }
+
+    updateBandSize = bandSize;
+    maxUpdateInterval = maxInterval;
 }
 
-const Properties& World::getTileProperties(const Vector2f& position) const
+void World::updateParallel()
 {
-    if (static_cast<int>(position.x) < 0) return tiles[0].properties;
-    if (static_cast<int>(position.y) < 0) return tiles[0].properties;
-    if (static_cast<int>(position.x) > worldWidth) return tiles[0].properties;
-    if (static_cast<int>(position.y) > worldHeight) return tiles[0].properties;
+    parallelEntities.clear();
 
-    int tileID = 0;
+    for (Entity* entity : scheduledEntities)
+    {
+        if (entity->parallelUpdate && containsEntity(entity)) parallelEntities.push_back(entity);
+    }
 
-    for (const TileLayer& layer : layers)
+    if (parallelEntities.empty()) return;
+
+    if (!jobSystem)
     {
-        if (const int tileIDTemp = layer.tileIds[static_cast<int>(position.x) + static_cast<int>(position.y) * worldWidth]; tileIDTemp != 0)
-            tileID = tileIDTemp;
+#ifdef __EMSCRIPTEN__
+        jobSystem = std::make_unique<JobSystem>(0);
+#else
+        jobSystem = std::make_unique<JobSystem>(std::clamp(std::thread::hardware_concurrency(), 1u, 16u) - 1);
+#endif
     }
 
-    return tiles[tileID].properties;
-}
+    for (const Entity* entity : entities)
+    {
+        entity->getAABB();
+    }
 
-std::vector<Intersection> World::getIntersections(const Entity* entity) const
-{
-    std::vector<Intersection> intersections;
+    BaseObject::hitboxesFrozen = true;
 
-    for (Entity* entityLoop : entities)
+    jobSystem->parallelFor(parallelEntities.size(), parallelUpdateGrainSize, [](void* context, const size_t begin, const size_t end)
     {
-        if (entity == entityLoop) continue;
+        Entity* const* entities = static_cast<Entity* const*>(context);
 
-        Intersection intersection;
-        intersection.entity = entityLoop;
-        intersection.worldObject = nullptr;
-        if (Collision::checkCollision(entity->getHitBox(), entityLoop->getHitBox(), intersection))
+        for (size_t i = begin; i < end; i++)
         {
-            intersections.push_back(intersection);
+            entities[i]->updateParallel();
         }
+    }, parallelEntities.data());
+
+    BaseObject::hitboxesFrozen = false;
+}
+
+void World::queueEntities()
+{
+    struct QueueContext
+    {
+        const World* world;
+        AABB viewport;
+        std::atomic<uint32_t> drawn = 0;
+        std::atomic<uint32_t> culled = 0;
+    };
+
+    const Vector2f cameraPosition = Renderer::getCameraPosition();
+    const Vector2f halfViewportSize = Renderer::getViewPortSize() / 2.0f + Vector2f(cullingMargin, cullingMargin);
+    QueueContext context = {this, {cameraPosition - halfViewportSize, cameraPosition + halfViewportSize}};
+
+    if (!jobSystem)
+    {
+        uint32_t culled = 0;
+        context.drawn = entityStorage->queue(entities, 0, entities.size(), context.viewport, culled);
+        context.culled = culled;
+    }
+    else
+    {
+        jobSystem->parallelFor(entities.size(), entityQueueGrainSize, [](void* context, const size_t begin, const size_t end)
+        {
+            QueueContext* queueContext = static_cast<QueueContext*>(context);
+            const World* world = queueContext->world;
+            uint32_t culled = 0;
+            queueContext->drawn += world->entityStorage->queue(world->entities, begin, end, queueContext->viewport, culled);
+            queueContext->culled += culled;
+        }, &context);
     }
 
-    for (WorldObject* worldObject : worldObjects)
+    cullingStats.culledEntities = context.culled;
+    cullingStats.drawnEntities = context.drawn;
+}
+
+void World::queueHUDObject(HUDObject* hudObject)
+{
+    const Vector2f position = hudObject->getPosition();
+    const AABB bounds = {position, position + hudObject->getScale()};
+    const AABB screen = {{0.0f, 0.0f}, Renderer::getScreenSize()};
+
+    if (!bounds.overlaps(screen))
     {
-        Intersection intersection;
-        intersection.entity = nullptr;
-        intersection.worldObject = worldObject;
-        if (Collision::checkCollision(entity->getHitBox(), worldObject->getHitbox(), intersection))
+        cullingStats.culledHUDObjects++;
+    }
+    else if (hudObject->queue())
+    {
+        cullingStats.drawnHUDObjects++;
+    }
+}
+
+void World::setCullingMargin(const float margin)
+{
+    cullingMargin = margin;
+}
+
+const CullingStats& World::getCullingStats() const
+{
+    return cullingStats;
+}
+
+void World::applyCommands()
+{
+    for (const WorldCommand& command : commands)
+    {
+        switch (command.type)
         {
-            intersections.push_back(intersection);
+            case WorldCommandType::addEntity:
+                insertEntity(command.slot);
+                break;
+            case WorldCommandType::removeEntity:
+                releaseEntitySlot(command.slot);
+                break;
+            case WorldCommandType::destroyEntity:
+                releaseEntitySlot(command.slot);
+                deleteEntity(command.entity);
+                break;
+            case WorldCommandType::addHUDObject:
+                hudObjects.push_back(command.hudObject);
+                break;
+            case WorldCommandType::removeHUDObject:
+                std::erase(hudObjects, command.hudObject);
+                break;
+            case WorldCommandType::destroyHUDObject:
+                std::erase(hudObjects, command.hudObject);
+                delete command.hudObject;
+                break;
         }
     }
 
-    return intersections;
+    commands.clear();
 }
 
 void World::loadTileset(const std::string &source, int firstId)
@@ -279,7 +1547,7 @@ void World::loadTileset(const std::string &source, int firstId)
                 if (!propertyType)
                 {
                     tiles[id + firstId].properties.setString(propertyName, propertyValue);
-                    break;
+                    continue;
                 }
     
                 if (!strcmp(propertyType, "bool"))
@@ -332,6 +1600,7 @@ void World::loadTilemap(const std::string& tilemapName)
     layers.clear();
     foregroundLayers.clear();
     worldObjects.clear();
+    std::erase_if(contacts, [](const Contact& contact) { return contact.worldObject != nullptr; });
 
     tinyxml2::XMLDocument tilemapXML;
     tilemapXML.LoadFile(tileMapPath.c_str());
@@ -397,7 +1666,7 @@ void World::loadTilemap(const std::string& tilemapName)
                         if (!propertyType)
                         {
                             worldObject->properties.setString(propertyName, propertyValue);
-                            break;
+                            continue;
                         }
     
                         if (!strcmp(propertyType, "bool"))
@@ -455,7 +1724,7 @@ void World::loadTilemap(const std::string& tilemapName)
                 }
                 else if (ellipse)
                 {
-                    hitbox.isEllipse = true;
+                    hitbox.shape = HitboxShape::ellipse;
                     hitbox.center.x = x + width / 2;
                     hitbox.center.y = y + height / 2;
                     hitbox.ellipse.x = width / 2;
@@ -463,17 +1732,26 @@ void World::loadTilemap(const std::string& tilemapName)
                 }
                 else if (point)
                 {
+                    hitbox.shape = HitboxShape::point;
                     hitbox.center = {x, y};
                     hitbox.vertices.emplace_back(x, y);
                 }
                 else
                 {
+                    hitbox.shape = HitboxShape::aabb;
+                    hitbox.center = {x + width / 2, y + height / 2};
                     hitbox.vertices.emplace_back(x, y);
-                    hitbox.vertices.emplace_back(x, y + height);
                     hitbox.vertices.emplace_back(x + width, y);
                     hitbox.vertices.emplace_back(x + width, y + height);
+                    hitbox.vertices.emplace_back(x, y + height);
                 }
+                CollisionFilter filter;
+                if (const int category = worldObject->properties.getInt("collisionCategory")) filter.category = category;
+                if (const int mask = worldObject->properties.getInt("collisionMask")) filter.mask = mask;
+
                 worldObject->setHitbox(hitbox);
+                worldObject->setCollisionFilter(filter);
+                worldObject->setTrigger(worldObject->properties.getString("type") == "trigger");
                 worldObjects.push_back(worldObject);
             }
         }
@@ -494,6 +1772,33 @@ void World::loadTilemap(const std::string& tilemapName)
         loadTileset(source, firstId);
     }
 
+    tileFlags.clear();
+
+    for (const Tile& tile : tiles)
+    {
+        uint32_t flags = tile.properties.getInt("flags");
+        if (tile.properties.getBool("solid")) flags |= TileFlags::solid;
+        if (tile.properties.getBool("water")) flags |= TileFlags::water;
+        if (tile.properties.getBool("damage")) flags |= TileFlags::damage;
+        if (tile.properties.getBool("ladder")) flags |= TileFlags::ladder;
+        if (tile.properties.getBool("oneWay")) flags |= TileFlags::oneWay;
+        tileFlags.push_back(flags);
+    }
+
+    topmostTileIds.assign(worldWidth * worldHeight, 0);
+    cellFlags.assign(worldWidth * worldHeight, TileFlags::none);
+    flowFields.clear();
+
+    for (int y = 0; y < worldHeight; y++)
+    {
+        for (int x = 0; x < worldWidth; x++)
+        {
+            updateTopmostTileId(x, y);
+        }
+    }
+
+    pathfinder->setGrid(worldWidth, worldHeight, cellFlags);
+
     for (tinyxml2::XMLElement* objectGroup = mapXMLElement->FirstChildElement("objectgroup"); objectGroup != nullptr; objectGroup = objectGroup->NextSiblingElement())
     {
         
@@ -503,6 +1808,13 @@ void World::loadTilemap(const std::string& tilemapName)
 
 World::~World()
 {
+    for (size_t i = entities.size(); i-- > 0;)
+    {
+        entityStorage->remove(entities[i], entities[i]);
+        entities[i]->world = nullptr;
+        entities[i]->handle = {};
+    }
+
     for (const WorldObject* worldObject : worldObjects)
     {
         delete worldObject;
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+class Entity;
+class HUDObject;
+
+enum class WorldCommandType
+{
+    addEntity,
+    removeEntity,
+    destroyEntity,
+    addHUDObject,
+    removeHUDObject,
+    destroyHUDObject,
+};
+
+struct WorldCommand
+{
+    WorldCommandType type;
+    uint32_t slot;
+    Entity* entity;
+    HUDObject* hudObject;
+};
\ No newline at end of file
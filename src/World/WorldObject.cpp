@@ -1,11 +1,57 @@
 #include "Bee/World/WorldObject.hpp"
 
-Hitbox WorldObject::getHitbox() const
+#include "Bee/Log.hpp"
+#include "Collision/Collision.hpp"
+
+const Hitbox& WorldObject::getHitbox() const
 {
     return hitbox;
 }
 
+const AABB& WorldObject::getAABB() const
+{
+    return aabb;
+}
+
+const CollisionFilter& WorldObject::getCollisionFilter() const
+{
+    return collisionFilter;
+}
+
+size_t WorldObject::getConvexPartCount() const
+{
+    return convexOffsets.empty() ? 0 : convexOffsets.size() - 1;
+}
+
+std::span<const Vector2f> WorldObject::getConvexPart(const size_t index) const
+{
+    return {convexVertices.data() + convexOffsets[index], convexOffsets[index + 1] - convexOffsets[index]};
+}
+
+bool WorldObject::isTrigger() const
+{
+    return trigger;
+}
+
 void WorldObject::setHitbox(const Hitbox& hitbox)
 {
     this->hitbox = hitbox;
+    aabb = Collision::getBounds(hitbox);
+    convexVertices.clear();
+    convexOffsets.clear();
+
+    if (hitbox.shape == HitboxShape::polygon && !Collision::decompose(hitbox.vertices, convexVertices, convexOffsets))
+    {
+        Log::write("WorldObject", LogLevel::warning, "Could not split concave polygon hitbox into convex parts");
+    }
+}
+
+void WorldObject::setCollisionFilter(const CollisionFilter& filter)
+{
+    collisionFilter = filter;
+}
+
+void WorldObject::setTrigger(const bool trigger)
+{
+    this->trigger = trigger;
 }
\ No newline at end of file